@@ -4,6 +4,18 @@
 #include <charconv>
 #include <cctype>
 #include <map>
+#include <utility>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+#include <unordered_map>
+#include <unordered_set>
+#include <exception>
 
 // Constructors
 Json::Json() noexcept : impl_(Impl::AcquireImpl()) {}
@@ -22,6 +34,7 @@ Json::Json(const Json& other) : impl_(Impl::AcquireImpl()) { *impl_ = *other.imp
 Json& Json::operator=(const Json& other) {
     if (this != &other) {
         *impl_ = *other.impl_;
+        if (impl_->track_) [[unlikely]] ChangeTracker::Record(*impl_, *this);
     }
     return *this;
 }
@@ -29,17 +42,54 @@ Json& Json::operator=(const Json& other) {
 // Move operations - FIXED: Properly handle custom destructor
 Json::Json(Json&& other) noexcept : impl_(std::move(other.impl_)) {
     // other.impl_ is now nullptr, so its destructor won't do expensive cleanup
+    if (impl_ && impl_->track_) [[unlikely]] {
+        // A tracked value stays in its document: moving out of it copies
+        other.impl_ = std::move(impl_);
+        impl_ = Impl::AcquireImpl();
+        *impl_ = *other.impl_;
+    }
 }
 
 Json& Json::operator=(Json&& other) noexcept {
     if (this != &other) {
+        const bool tracked_source = other.impl_ && other.impl_->track_;
+        if (impl_ && (impl_->track_ || tracked_source)) [[unlikely]] {
+            // Tracked values keep their Impl, which carries their place in
+            // the document; a tracked source is copied rather than emptied
+            if (tracked_source) {
+                *impl_ = *other.impl_;
+            } else if (other.impl_) {
+                auto source = std::move(other.impl_);
+                *impl_ = std::move(*source);
+                Impl::ReleaseImpl(std::move(source));
+            }
+            if (impl_->track_) ChangeTracker::Record(*impl_, *this);
+            return *this;
+        }
+        if (!impl_ && tracked_source) [[unlikely]] {
+            impl_ = Impl::AcquireImpl();
+            *impl_ = *other.impl_;
+            return *this;
+        }
+
         // Clean up current object first
+        // Indexes follow the variable, not the value: this keeps its own
+        // indexes (now over the new value) and other's are detached
         if (impl_) {
             auto temp_impl = std::move(impl_);
+            impl_ = std::move(other.impl_);
+            if (impl_) {
+                if (temp_impl->indexes_) {
+                    impl_->AdoptIndexes(*temp_impl);
+                } else if (impl_->indexes_) {
+                    impl_->DetachIndexes();
+                }
+            }
             Impl::ReleaseImpl(std::move(temp_impl));
+        } else {
+            impl_ = std::move(other.impl_);
+            if (impl_ && impl_->indexes_) impl_->DetachIndexes();
         }
-        // Move from other
-        impl_ = std::move(other.impl_);
         // other.impl_ is now nullptr
     }
     return *this;
@@ -372,55 +422,22 @@ Json Json::Parse(std::string_view json_string) {
     return parser.Parse();
 }
 
-// Type checking
-bool Json::IsNull() const noexcept { 
-    if (!impl_) return false; // Safe default for moved-from objects
-    return impl_->GetType() == Type::Null; 
-}
-bool Json::IsBoolean() const noexcept { 
-    if (!impl_) return false; // Safe default for moved-from objects
-    return impl_->GetType() == Type::Boolean; 
-}
-bool Json::IsNumber() const noexcept { 
-    if (!impl_) return false; // Safe default for moved-from objects
-    return impl_->GetType() == Type::Number; 
-}
-bool Json::IsString() const noexcept { 
-    if (!impl_) return false; // Safe default for moved-from objects
-    return impl_->GetType() == Type::String; 
-}
-bool Json::IsArray() const noexcept { 
-    if (!impl_) return false; // Safe default for moved-from objects
-    return impl_->GetType() == Type::Array; 
-}
-bool Json::IsObject() const noexcept { 
-    if (!impl_) return false; // Safe default for moved-from objects
-    return impl_->GetType() == Type::Object; 
-}
-Json::Type Json::GetType() const noexcept { 
-    if (!impl_) return Type::Null; // Safe default for moved-from objects
-    return impl_->GetType(); 
-}
-
 // Array operations
-Json& Json::operator[](size_t index) {
-    ensure_valid();
-    return impl_->At(index);
-}
-
-const Json& Json::operator[](size_t index) const {
-    ensure_valid();
-    return impl_->At(index);
-}
-
 void Json::PushBack(Json value) {
     ensure_valid();
     impl_->PushBack(std::move(value));
+    if (impl_->track_) [[unlikely]] {
+        const auto& arr = std::as_const(*impl_).GetArray();
+        ChangeTracker::Record(*impl_, ChangeTracker::Op::Add, std::to_string(arr.size() - 1), &arr.back());
+    }
 }
 
 void Json::PopBack() {
     ensure_valid();
     impl_->PopBack();
+    if (impl_->track_) [[unlikely]] {
+        ChangeTracker::Record(*impl_, ChangeTracker::Op::Remove, std::to_string(impl_->Size()), nullptr);
+    }
 }
 
 void Json::Reserve(size_t capacity) {
@@ -431,18 +448,15 @@ void Json::Reserve(size_t capacity) {
     }
 }
 
-size_t Json::Size() const {
-    ensure_valid();
-    if (!IsArray() && !IsObject()) {
-        throw JsonException("Size() can only be called on arrays or objects");
-    }
-    return impl_->Size();
-}
-
 // Object operations
 Json& Json::operator[](std::string_view key) {
     ensure_valid();
-    return (*impl_)[key];
+    if (!impl_->track_) [[likely]] return (*impl_)[key];
+    const bool added = !std::as_const(*impl_).Find(key);
+    Json& member = (*impl_)[key];
+    ChangeTracker::Track(*impl_, member, std::as_const(*impl_).GetObject().find(key)->first);
+    if (added) ChangeTracker::Record(*impl_, ChangeTracker::Op::Add, key, &member);
+    return member;
 }
 
 const Json& Json::operator[](std::string_view key) const {
@@ -460,357 +474,1444 @@ bool Json::Contains(std::string_view key) const {
 
 void Json::Remove(std::string_view key) {
     ensure_valid();
+    const bool tracked = impl_->track_ && std::as_const(*impl_).Find(key);
     impl_->Remove(key);
+    if (tracked) [[unlikely]] ChangeTracker::Record(*impl_, ChangeTracker::Op::Remove, key, nullptr);
 }
 
-std::vector<std::string> Json::Keys() const {
+Json& Json::operator[](KeyView key) {
     ensure_valid();
-    return impl_->Keys();
+    if (!impl_->track_) [[likely]] return (*impl_)[key];
+    const bool added = !std::as_const(*impl_).Find(key);
+    Json& member = (*impl_)[key];
+    ChangeTracker::Track(*impl_, member, std::as_const(*impl_).GetObject().find(key)->first);
+    if (added) ChangeTracker::Record(*impl_, ChangeTracker::Op::Add, key.Name(), &member);
+    return member;
 }
 
-// Serialization
-std::string Json::ToString(bool pretty) const {
+const Json& Json::operator[](KeyView key) const {
     ensure_valid();
-    return impl_->ToString(pretty);
+    return impl_->At(key);
 }
 
-// Exception implementations
-// Validity check implementation
-void Json::ensure_valid() const {
-    if (!impl_) {
-        throw JsonException("Operation on moved-from or invalid Json object");
+bool Json::Contains(KeyView key) const {
+    ensure_valid();
+    if (!IsObject()) {
+        throw JsonException("Contains() can only be called on objects");
     }
+    return impl_->Contains(key);
 }
 
-JsonException::JsonException(const std::string& message) : std::runtime_error(message) {}
-JsonException::JsonException(const char* message) : std::runtime_error(message) {}
+void Json::Remove(KeyView key) {
+    ensure_valid();
+    const bool tracked = impl_->track_ && std::as_const(*impl_).Find(key);
+    impl_->Remove(key);
+    if (tracked) [[unlikely]] ChangeTracker::Record(*impl_, ChangeTracker::Op::Remove, key.Name(), nullptr);
+}
 
-JsonTypeError::JsonTypeError(Json::Type expected, Json::Type actual) 
-    : JsonException("Type mismatch: expected " + std::to_string(static_cast<int>(expected)) + 
-                   ", got " + std::to_string(static_cast<int>(actual))) {}
+const Json* Json::Find(std::string_view key) const noexcept {
+    return impl_ ? std::as_const(*impl_).Find(key) : nullptr;
+}
 
-JsonParseError::JsonParseError(const std::string& message, size_t line, size_t column)
-    : JsonException(message + " at line " + std::to_string(line) + ", column " + std::to_string(column))
-    , line_(line)
-    , column_(column) {}
+const Json* Json::Find(KeyView key) const noexcept {
+    return impl_ ? std::as_const(*impl_).Find(key) : nullptr;
+}
 
-size_t JsonParseError::Line() const noexcept { return line_; }
-size_t JsonParseError::Column() const noexcept { return column_; }
+Json* Json::Find(std::string_view key) {
+    Json* found = impl_ ? impl_->Find(key) : nullptr;
+    if (found && impl_->track_) [[unlikely]] {
+        ChangeTracker::Track(*impl_, *found, std::as_const(*impl_).GetObject().find(key)->first);
+    }
+    return found;
+}
 
-// Array Iterator implementations
-Json::Iterator::Iterator() noexcept : impl_(nullptr), index_(0) {}
+Json* Json::Find(KeyView key) {
+    Json* found = impl_ ? impl_->Find(key) : nullptr;
+    if (found && impl_->track_) [[unlikely]] {
+        ChangeTracker::Track(*impl_, *found, std::as_const(*impl_).GetObject().find(key)->first);
+    }
+    return found;
+}
 
-Json::Iterator::Iterator(Impl* impl, size_t index) : impl_(impl), index_(index) {}
+std::vector<std::string> Json::Keys() const {
+    ensure_valid();
+    return impl_->Keys();
+}
 
-Json::Iterator& Json::Iterator::operator++() {
-    ++index_;
-    return *this;
+Json::KeyRange Json::KeysView() const noexcept {
+    return KeyRange(IsObject() ? &std::as_const(*impl_).GetObject() : nullptr);
 }
 
-Json::Iterator Json::Iterator::operator++(int) {
-    Iterator tmp(*this);
-    ++*this;
-    return tmp;
+Json::ValueRange Json::Values() {
+    if (!IsObject()) return ValueRange(nullptr);
+    auto& obj = impl_->GetObject();  // Unshares once, up front
+    if (impl_->track_) [[unlikely]] ChangeTracker::TrackChildren(*impl_);
+    return ValueRange(&obj);
 }
 
-Json::Iterator& Json::Iterator::operator--() {
-    --index_;
-    return *this;
+Json::ConstValueRange Json::Values() const noexcept {
+    return ConstValueRange(IsObject() ? &std::as_const(*impl_).GetObject() : nullptr);
+}
+
+// JSON Pointer
+Json::Pointer::Pointer(std::string_view text) : text_(text) {
+    if (text.empty()) return;
+    if (text.front() != '/') {
+        throw JsonException("Invalid JSON pointer (must start with '/'): " + text_);
+    }
+
+    size_t pos = 1;
+    while (true) {
+        const size_t end = std::min(text.find('/', pos), text.size());
+        Segment segment;
+        segment.name.reserve(end - pos);
+        for (size_t i = pos; i < end; ++i) {
+            if (text[i] != '~') {
+                segment.name += text[i];
+                continue;
+            }
+            const char escaped = i + 1 < end ? text[i + 1] : '\0';
+            if (escaped != '0' && escaped != '1') {
+                throw JsonException("Invalid escape in JSON pointer: " + text_);
+            }
+            segment.name += escaped == '0' ? '~' : '/';
+            ++i;
+        }
+        segment.hash = KeyView::Hash(segment.name);
+
+        // RFC 6901 array index: "0" or digits without a leading zero
+        const std::string& name = segment.name;
+        if (!name.empty() && (name == "0" || name.front() != '0')) {
+            size_t index = 0;
+            auto [ptr, ec] = std::from_chars(name.data(), name.data() + name.size(), index);
+            if (ec == std::errc() && ptr == name.data() + name.size()) segment.index = index;
+        }
+
+        segments_.push_back(std::move(segment));
+        if (end == text.size()) break;
+        pos = end + 1;
+    }
+}
+
+const Json* Json::Find(const Pointer& pointer) const noexcept {
+    const Json* current = this;
+    for (const auto& segment : pointer.Segments()) {
+        if (current->IsArray()) {
+            std::span<const Json> items = current->Elements();
+            if (segment.index >= items.size()) return nullptr;
+            current = &items[segment.index];
+        } else {
+            current = current->Find(segment.Key());  // nullptr for scalars
+            if (!current) return nullptr;
+        }
+    }
+    return current->impl_ ? current : nullptr;
+}
+
+Json* Json::Find(const Pointer& pointer) {
+    // Resolve read-only first so a miss unshares nothing
+    if (!std::as_const(*this).Find(pointer)) return nullptr;
+
+    Json* current = this;
+    for (const auto& segment : pointer.Segments()) {
+        current = current->IsArray() ? &(*current)[segment.index] : current->Find(segment.Key());
+    }
+    return current;
+}
+
+const Json& Json::At(const Pointer& pointer) const {
+    if (const Json* found = Find(pointer)) return *found;
+    throw JsonException("JSON pointer does not resolve: " + pointer.ToString());
+}
+
+Json& Json::At(const Pointer& pointer) {
+    if (Json* found = Find(pointer)) return *found;
+    throw JsonException("JSON pointer does not resolve: " + pointer.ToString());
+}
+
+// JSON Patch (RFC 6902)
+Json Json::ApplyPatch(const Json& doc, const Json& patch) {
+    if (!patch.IsArray()) ThrowTypeError(Type::Array, patch.GetType());
+
+    // Work on a shallow copy: operations unshare only what they touch, and on
+    // failure the copy is simply dropped
+    Json result = doc;
+    std::span<const Json> operations = patch.Elements();
+    for (size_t i = 0; i < operations.size(); ++i) {
+        try {
+            ApplyPatchOperation(result, operations[i]);
+        } catch (const JsonException& e) {
+            throw JsonException("JSON Patch operation " + std::to_string(i) + " failed: " + e.what());
+        }
+    }
+    return result;
+}
+
+void Json::ApplyPatchOperation(Json& doc, const Json& operation) {
+    auto member = [&](std::string_view name) -> const Json& {
+        const Json* value = operation.IsObject() ? operation.Find(name) : nullptr;
+        if (!value) throw JsonException("missing \"" + std::string(name) + "\"");
+        return *value;
+    };
+    auto pointer = [&](std::string_view name) {
+        const Json& text = member(name);
+        if (!text.IsString()) throw JsonException("\"" + std::string(name) + "\" must be a string");
+        return Pointer(text.Get<std::string>());
+    };
+
+    // Parent of the last token, unsharing the containers on the way down
+    auto parent = [](Json& root, const Pointer& path) -> Json& {
+        const auto& segments = path.Segments();
+        Json* current = &root;
+        for (size_t i = 0; i + 1 < segments.size(); ++i) {
+            Json* next = nullptr;
+            if (current->IsArray()) {
+                std::span<Json> items = current->Elements();
+                if (segments[i].index < items.size()) next = &items[segments[i].index];
+            } else if (current->IsObject()) {
+                next = current->Find(segments[i].Key());
+            }
+            if (!next) throw JsonException("path does not exist: " + path.ToString());
+            current = next;
+        }
+        return *current;
+    };
+
+    auto add = [&](const Pointer& path, Json value) {
+        if (path.Empty()) {
+            doc = std::move(value);
+            return;
+        }
+        Json& target = parent(doc, path);
+        const auto& last = path.Segments().back();
+        if (target.IsArray()) {
+            auto& arr = target.impl_->GetArray();
+            const size_t index = last.name == "-" ? arr.size() : last.index;
+            if (index > arr.size()) throw JsonException("array index out of range: " + path.ToString());
+            arr.insert(arr.begin() + static_cast<std::ptrdiff_t>(index), std::move(value));
+        } else if (target.IsObject()) {
+            target[last.Key()] = std::move(value);
+        } else {
+            throw JsonException("path does not exist: " + path.ToString());
+        }
+    };
+
+    auto remove = [&](const Pointer& path) -> Json {
+        if (path.Empty()) throw JsonException("cannot remove the whole document");
+        Json& target = parent(doc, path);
+        const auto& last = path.Segments().back();
+        if (target.IsArray()) {
+            auto& arr = target.impl_->GetArray();
+            if (last.index < arr.size()) {
+                Json removed = std::move(arr[last.index]);
+                arr.erase(arr.begin() + static_cast<std::ptrdiff_t>(last.index));
+                return removed;
+            }
+        } else if (target.IsObject()) {
+            if (Json* value = target.Find(last.Key())) {
+                Json removed = std::move(*value);
+                target.Remove(last.Key());
+                return removed;
+            }
+        }
+        throw JsonException("path does not exist: " + path.ToString());
+    };
+
+    const Json& op_member = member("op");
+    if (!op_member.IsString()) throw JsonException("\"op\" must be a string");
+    const std::string& op = op_member.Get<std::string>();
+    const Pointer path = pointer("path");
+
+    if (op == "add") {
+        add(path, member("value"));
+    } else if (op == "remove") {
+        remove(path);
+    } else if (op == "replace") {
+        Json* target = doc.Find(path);
+        if (!target) throw JsonException("path does not exist: " + path.ToString());
+        *target = member("value");
+    } else if (op == "move") {
+        const Pointer from = pointer("from");
+        if (from.ToString() == path.ToString()) return;
+        const auto& a = from.Segments();
+        const auto& b = path.Segments();
+        if (a.size() < b.size() &&
+            std::equal(a.begin(), a.end(), b.begin(), [](const auto& x, const auto& y) { return x.name == y.name; })) {
+            throw JsonException("cannot move a value into itself: " + path.ToString());
+        }
+        add(path, remove(from));
+    } else if (op == "copy") {
+        const Pointer from = pointer("from");
+        const Json* source = std::as_const(doc).Find(from);
+        if (!source) throw JsonException("path does not exist: " + from.ToString());
+        add(path, *source);
+    } else if (op == "test") {
+        const Json* target = std::as_const(doc).Find(path);
+        if (!target || !(*target == member("value"))) throw JsonException("test failed at " + path.ToString());
+    } else {
+        throw JsonException("unknown op \"" + op + "\"");
+    }
 }
 
-Json::Iterator Json::Iterator::operator--(int) {
-    Iterator tmp(*this);
-    --*this;
-    return tmp;
+// JSON Merge Patch (RFC 7386)
+Json Json::MergePatch(Json target, Json patch) {
+    MergePatchInto(target, std::move(patch));
+    return target;
 }
 
-Json::Iterator::reference Json::Iterator::operator*() const {
-    return impl_->At(index_);
+void Json::MergePatchInto(Json& target, Json&& patch) {
+    if (!patch.IsObject()) {
+        target = std::move(patch);
+        return;
+    }
+    if (!target.IsObject()) target = Object();  // Nested nulls are still dropped below
+    for (auto [name, value] : patch.ObjectItems()) {
+        const KeyView key(name);
+        if (value.IsNull()) {
+            target.Remove(key);
+        } else {
+            MergePatchInto(target[key], std::move(value));
+        }
+    }
 }
 
-Json::Iterator::pointer Json::Iterator::operator->() const {
-    return &impl_->At(index_);
+// Structural diff
+namespace {
+
+Json PatchOperation(const char* op, const std::string& path) {
+    Json operation = Json::Object();
+    operation["op"] = op;
+    operation["path"] = path;
+    return operation;
 }
 
-bool Json::Iterator::operator==(const Iterator& other) const noexcept {
-    return impl_ == other.impl_ && index_ == other.index_;
+// Appends "/token" with RFC 6901 escaping
+void AppendPointerToken(std::string& path, std::string_view token) {
+    path += '/';
+    for (char c : token) {
+        if (c == '~') {
+            path += "~0";
+        } else if (c == '/') {
+            path += "~1";
+        } else {
+            path += c;
+        }
+    }
 }
 
-bool Json::Iterator::operator!=(const Iterator& other) const noexcept {
-    return !(*this == other);
+} // namespace
+
+Json Json::Diff(const Json& a, const Json& b) {
+    a.ensure_valid();
+    b.ensure_valid();
+    Json ops = Array();
+    std::string path;
+    DiffInto(a, b, path, ops);
+    return ops;
 }
 
-// Const Array Iterator implementations
-Json::ConstIterator::ConstIterator() noexcept : impl_(nullptr), index_(0) {}
+void Json::DiffInto(const Json& a, const Json& b, std::string& path, Json& ops) {
+    const auto& lhs = a.impl_->data_;
+    const auto& rhs = b.impl_->data_;
+    if (lhs == rhs) return;  // Shared storage: nothing below can differ
 
-Json::ConstIterator::ConstIterator(const Iterator& it) noexcept 
-    : impl_(it.impl_), index_(it.index_) {}
+    // Hashes are cached on shared blocks; equal ones still need confirming,
+    // but Equals stops early at every subtree the two sides share
+    const size_t lhs_hash = lhs->hash_.load(std::memory_order_relaxed);
+    const size_t rhs_hash = rhs->hash_.load(std::memory_order_relaxed);
+    if (lhs_hash != 0 && lhs_hash == rhs_hash && a.impl_->Equals(*b.impl_)) return;
 
-Json::ConstIterator::ConstIterator(const Impl* impl, size_t index) 
-    : impl_(impl), index_(index) {}
+    const Type type = a.GetType();
+    if (type != b.GetType() || (type != Type::Array && type != Type::Object)) {
+        if (!a.impl_->Equals(*b.impl_)) {
+            Json operation = PatchOperation("replace", path);
+            operation["value"] = b;
+            ops.PushBack(std::move(operation));
+        }
+        return;
+    }
 
-Json::ConstIterator& Json::ConstIterator::operator++() {
-    ++index_;
-    return *this;
+    const size_t length = path.size();
+    if (type == Type::Object) {
+        for (const auto& [key, value] : a.ObjectItems()) {
+            AppendPointerToken(path, key);
+            if (const Json* other = b.Find(KeyView(key))) {
+                DiffInto(value, *other, path, ops);
+            } else {
+                ops.PushBack(PatchOperation("remove", path));
+            }
+            path.resize(length);
+        }
+        for (const auto& [key, value] : b.ObjectItems()) {
+            if (a.Contains(KeyView(key))) continue;
+            AppendPointerToken(path, key);
+            Json operation = PatchOperation("add", path);
+            operation["value"] = value;
+            ops.PushBack(std::move(operation));
+            path.resize(length);
+        }
+        return;
+    }
+
+    std::span<const Json> left = a.Elements();
+    std::span<const Json> right = b.Elements();
+    const size_t common = std::min(left.size(), right.size());
+    for (size_t i = 0; i < common; ++i) {
+        AppendPointerToken(path, std::to_string(i));
+        DiffInto(left[i], right[i], path, ops);
+        path.resize(length);
+    }
+    // Remove from the back so earlier indices stay valid
+    for (size_t i = left.size(); i > common; --i) {
+        AppendPointerToken(path, std::to_string(i - 1));
+        ops.PushBack(PatchOperation("remove", path));
+        path.resize(length);
+    }
+    for (size_t i = common; i < right.size(); ++i) {
+        AppendPointerToken(path, std::to_string(i));
+        Json operation = PatchOperation("add", path);
+        operation["value"] = right[i];
+        ops.PushBack(std::move(operation));
+        path.resize(length);
+    }
 }
 
-Json::ConstIterator Json::ConstIterator::operator++(int) {
-    ConstIterator tmp(*this);
-    ++*this;
-    return tmp;
+// Change tracking
+Json::ChangeTracker::ChangeTracker(const Json& root) : root_(&root) {
+    root.ensure_valid();
+    if (root.impl_->track_) throw JsonException("Document is already tracked");
+    std::lock_guard lock(mutex_);
+    root_node_ = Attach(*root.impl_, nullptr);
+    AttachTree(*root.impl_, root_node_);
 }
 
-Json::ConstIterator& Json::ConstIterator::operator--() {
-    --index_;
-    return *this;
+Json::ChangeTracker::~ChangeTracker() {
+    std::lock_guard lock(mutex_);
+    for (const auto& block : nodes_) {
+        for (size_t i = 0; i < kNodeBlock; ++i) {
+            if (block[i].impl) block[i].impl->track_ = nullptr;
+        }
+    }
 }
 
-Json::ConstIterator Json::ConstIterator::operator--(int) {
-    ConstIterator tmp(*this);
-    --*this;
-    return tmp;
+bool Json::ChangeTracker::Changed() const {
+    std::lock_guard lock(mutex_);
+    return !journal_.empty();
 }
 
-Json::ConstIterator::reference Json::ConstIterator::operator*() const {
-    return impl_->At(index_);
+Json Json::ChangeTracker::Drain() {
+    // Entries are taken out first: dropping their values may release
+    // tracked values, which takes the lock again
+    std::vector<Entry> entries;
+    {
+        std::lock_guard lock(mutex_);
+        entries.swap(journal_);
+    }
+    static constexpr const char* kOpNames[] = {"add", "remove", "replace", "move"};
+    Json ops = Array();
+    ops.Reserve(entries.size());
+    for (Entry& entry : entries) {
+        Json operation = PatchOperation(kOpNames[static_cast<int>(entry.op)], entry.path);
+        if (entry.op == Op::Move) {
+            operation["from"] = std::move(entry.from);
+        } else if (entry.op != Op::Remove) {
+            operation["value"] = std::move(entry.value);
+        }
+        ops.PushBack(std::move(operation));
+    }
+    return ops;
 }
 
-Json::ConstIterator::pointer Json::ConstIterator::operator->() const {
-    return &impl_->At(index_);
+void Json::ChangeTracker::Reset() {
+    std::vector<Entry> entries;
+    std::lock_guard lock(mutex_);
+    entries.swap(journal_);
 }
 
-bool Json::ConstIterator::operator==(const ConstIterator& other) const noexcept {
-    return impl_ == other.impl_ && index_ == other.index_;
+Json::ChangeTracker::Node* Json::ChangeTracker::Attach(Impl& impl, Node* parent) {
+    Node* node = impl.track_;
+    if (!node) {
+        if (free_.empty()) {
+            // Allocated in blocks: construction tags every value
+            nodes_.push_back(std::make_unique<Node[]>(kNodeBlock));
+            for (size_t i = kNodeBlock; i > 0; --i) free_.push_back(&nodes_.back()[i - 1]);
+        }
+        node = free_.back();
+        free_.pop_back();
+        node->tracker = this;
+        node->impl = &impl;
+        impl.track_ = node;
+    }
+    node->parent = parent;
+    return node;
+}
+
+// Tags a whole subtree on construction. Values tracked by another document
+// sit in storage shared with it and are left alone: they are only reached
+// after this document unshares them, and then as fresh copies.
+void Json::ChangeTracker::AttachTree(Impl& impl, Node* node) {
+    const auto& value = impl.data_->value_;
+    if (const auto* arr = std::get_if<Impl::Array>(&value)) {
+        for (size_t i = 0; i < arr->size(); ++i) {
+            Impl& child = *(*arr)[i].impl_;
+            if (child.track_ && child.track_->tracker != this) continue;
+            Node* child_node = Attach(child, node);
+            child_node->key = nullptr;
+            child_node->index = i;
+            AttachTree(child, child_node);
+        }
+    } else if (const auto* obj = std::get_if<Impl::Object>(&value)) {
+        for (const auto& [key, member] : *obj) {
+            Impl& child = *member.impl_;
+            if (child.track_ && child.track_->tracker != this) continue;
+            Node* child_node = Attach(child, node);
+            child_node->key = &key;
+            AttachTree(child, child_node);
+        }
+    }
 }
 
-bool Json::ConstIterator::operator!=(const ConstIterator& other) const noexcept {
-    return !(*this == other);
+void Json::ChangeTracker::Track(Impl& parent, Json& child, const std::string& key) {
+    ChangeTracker& tracker = *parent.track_->tracker;
+    if (child.impl_->track_ && child.impl_->track_->tracker != &tracker) Release(*child.impl_);
+    std::lock_guard lock(tracker.mutex_);
+    tracker.Attach(*child.impl_, parent.track_)->key = &key;
 }
 
-// Object Iterator Implementation classes
-class Json::ObjectIterator::ObjectIterImpl {
-public:
-    Json::Impl::Object::iterator it_;
-    Json::Impl::Object::iterator end_it_;  // Store the end iterator for comparison
-    Json::KeyValue current_;
-    bool valid_;
-    Json dummy_json_;  // Dummy Json object for invalid iterators
-
-    ObjectIterImpl() : current_("", dummy_json_), valid_(false) {}
-    
-    ObjectIterImpl(Json::Impl::Object::iterator it, Json::Impl::Object::iterator end_it) 
-        : it_(it), end_it_(end_it), current_("", dummy_json_), valid_(it != end_it) {
-        Update();
-    }
-    
-    void Update() {
-        if (valid_ && it_ != end_it_) {
-            current_.key = it_->first;
-            current_.value_ptr = &it_->second;
-        } else {
-            valid_ = false;
+void Json::ChangeTracker::Track(Impl& parent, Json& child, size_t index) {
+    ChangeTracker& tracker = *parent.track_->tracker;
+    if (child.impl_->track_ && child.impl_->track_->tracker != &tracker) Release(*child.impl_);
+    std::lock_guard lock(tracker.mutex_);
+    Node* node = tracker.Attach(*child.impl_, parent.track_);
+    node->key = nullptr;
+    node->index = index;
+}
+
+void Json::ChangeTracker::TrackChildren(Impl& parent) {
+    auto& value = parent.data_->value_;  // Already unshared by the caller
+    if (auto* arr = std::get_if<Impl::Array>(&value)) {
+        for (size_t i = 0; i < arr->size(); ++i) Track(parent, (*arr)[i], i);
+    } else if (auto* obj = std::get_if<Impl::Object>(&value)) {
+        for (auto& [key, member] : *obj) Track(parent, member, key);
+    }
+}
+
+void Json::ChangeTracker::Release(Impl& impl) noexcept {
+    ChangeTracker& tracker = *impl.track_->tracker;
+    std::lock_guard lock(tracker.mutex_);
+    tracker.Detach(impl);
+}
+
+void Json::ChangeTracker::Detach(Impl& impl) noexcept {
+    Node* node = impl.track_;
+    node->impl = nullptr;
+    node->parent = nullptr;
+    node->key = nullptr;
+    impl.track_ = nullptr;
+    free_.push_back(node);
+}
+
+// Walks up to the root, checking at every step that the value still sits
+// where its node says in its parent's current storage. A value left behind
+// in storage the document no longer uses (after an unshare, or inside a
+// replaced value) fails the check.
+bool Json::ChangeTracker::PathOf(const Node* node, std::string& path) {
+    chain_.clear();
+    const Node* current = node;
+    for (; current->parent; current = current->parent) {
+        const Impl* parent = current->parent->impl;
+        if (!parent) return false;
+        const auto& value = parent->data_->value_;
+        bool found = false;
+        if (const auto* arr = std::get_if<Impl::Array>(&value)) {
+            found = current->index < arr->size() && (*arr)[current->index].impl_.get() == current->impl;
+        } else if (const auto* obj = std::get_if<Impl::Object>(&value); obj && current->key) {
+            auto it = obj->find(*current->key);
+            found = it != obj->end() && it->second.impl_.get() == current->impl;
         }
+        if (!found) return false;
+        chain_.push_back(current);
     }
-};
+    if (current != root_node_ || root_->impl_.get() != current->impl) return false;
 
-class Json::ConstObjectIterator::ConstObjectIterImpl {
-public:
-    Json::Impl::Object::const_iterator it_;
-    Json::Impl::Object::const_iterator end_it_;  // Store the end iterator for comparison
-    Json::ConstKeyValue current_;
-    bool valid_;
-    Json dummy_json_;  // Dummy Json object for invalid iterators
-
-    ConstObjectIterImpl() : current_("", dummy_json_), valid_(false) {}
-    
-    ConstObjectIterImpl(Json::Impl::Object::const_iterator it, Json::Impl::Object::const_iterator end_it) 
-        : it_(it), end_it_(end_it), current_("", dummy_json_), valid_(it != end_it) {
-        Update();
-    }
-    
-    void Update() {
-        if (valid_ && it_ != end_it_) {
-            current_.key = it_->first;
-            current_.value_ptr = &it_->second;
+    path.clear();
+    for (auto it = chain_.rbegin(); it != chain_.rend(); ++it) {
+        const Node* step = *it;
+        if (step->parent->impl->GetType() == Type::Array) {
+            AppendPointerToken(path, std::to_string(step->index));
         } else {
-            valid_ = false;
+            AppendPointerToken(path, *step->key);
         }
     }
-};
+    return true;
+}
+
+// Folds the entry into the previous one when both address the same path
+void Json::ChangeTracker::Append(Entry&& entry, Json& displaced) {
+    if (!journal_.empty()) {
+        Entry& last = journal_.back();
+        if (last.path == entry.path && (last.op == Op::Add || last.op == Op::Replace)) {
+            if (entry.op == Op::Replace) {
+                displaced = std::move(last.value);
+                last.value = std::move(entry.value);
+                return;
+            }
+            if (entry.op == Op::Remove && last.op == Op::Add) {
+                displaced = std::move(last.value);
+                journal_.pop_back();
+                return;
+            }
+        }
+    }
+    journal_.push_back(std::move(entry));
+}
+
+// Journal values are copied and dropped outside the lock: releasing a value
+// can release tracked values inside it, which takes the lock again
+void Json::ChangeTracker::Record(Impl& target, const Json& value) {
+    ChangeTracker& tracker = *target.track_->tracker;
+    Entry entry{Op::Replace, {}, {}, value};
+    Json displaced;
+    std::lock_guard lock(tracker.mutex_);
+    if (!tracker.PathOf(target.track_, entry.path)) {
+        tracker.Detach(target);  // No longer part of the document
+        return;
+    }
+    tracker.Append(std::move(entry), displaced);
+}
 
-// Object Iterator implementations
-Json::ObjectIterator::ObjectIterator() noexcept 
-    : impl_(std::make_unique<ObjectIterImpl>()) {}
+void Json::ChangeTracker::Record(Impl& parent, Op op, std::string_view token, const Json* value) {
+    ChangeTracker& tracker = *parent.track_->tracker;
+    Entry entry{op, {}, {}, value ? *value : Json()};
+    Json displaced;
+    std::lock_guard lock(tracker.mutex_);
+    if (!tracker.PathOf(parent.track_, entry.path)) {
+        tracker.Detach(parent);
+        return;
+    }
+    AppendPointerToken(entry.path, token);
+    tracker.Append(std::move(entry), displaced);
+}
+
+// A reordering as JSON Patch moves: the element for each target position is
+// moved there from the unplaced remainder, which keeps its original order.
+// Its current position is the target plus the number of unplaced elements
+// that started before it, counted with a Fenwick tree.
+void Json::ChangeTracker::RecordPermutation(Impl& parent, const std::vector<size_t>& order) {
+    ChangeTracker& tracker = *parent.track_->tracker;
+    std::lock_guard lock(tracker.mutex_);
+    std::string base;
+    if (!tracker.PathOf(parent.track_, base)) {
+        tracker.Detach(parent);
+        return;
+    }
 
-Json::ObjectIterator::ObjectIterator(const ObjectIterator& other) 
-    : impl_(std::make_unique<ObjectIterImpl>(*other.impl_)) {}
+    const size_t n = order.size();
+    std::vector<size_t> unplaced(n + 1);
+    for (size_t i = 1; i <= n; ++i) unplaced[i] = i & (~i + 1);  // Every element starts unplaced
+    for (size_t target = 0; target < n; ++target) {
+        const size_t original = order[target];
+        size_t before = 0;
+        for (size_t i = original; i > 0; i -= i & (~i + 1)) before += unplaced[i];
+        for (size_t i = original + 1; i <= n; i += i & (~i + 1)) --unplaced[i];
+        if (before == 0) continue;  // Already in place
+
+        Entry entry{Op::Move, base, base, Json()};
+        AppendPointerToken(entry.path, std::to_string(target));
+        AppendPointerToken(entry.from, std::to_string(target + before));
+        tracker.journal_.push_back(std::move(entry));
+    }
+}
 
-Json::ObjectIterator::ObjectIterator(ObjectIterator&& other) noexcept 
-    : impl_(std::move(other.impl_)) {}
+// Atomically published documents
+Json::AtomicRef::AtomicRef() : current_(new Snapshot(std::make_shared<const Json>())) {}
 
-Json::ObjectIterator& Json::ObjectIterator::operator=(const ObjectIterator& other) {
-    if (this != &other) {
-        impl_ = std::make_unique<ObjectIterImpl>(*other.impl_);
+Json::AtomicRef::AtomicRef(Json initial)
+    : current_(new Snapshot(std::make_shared<const Json>(std::move(initial)))) {}
+
+Json::AtomicRef::~AtomicRef() {
+    delete current_.load();
+}
+
+Json::AtomicRef::Snapshot Json::AtomicRef::Load() const {
+    // Register in the current epoch; re-checking it guarantees that a writer
+    // advancing the epoch afterwards sees this reader and waits for it
+    unsigned epoch = epoch_.load();
+    while (true) {
+        readers_[epoch & 1].fetch_add(1);
+        const unsigned now = epoch_.load();
+        if (now == epoch) break;
+        readers_[epoch & 1].fetch_sub(1);
+        epoch = now;
     }
-    return *this;
+    Snapshot snapshot = *current_.load();
+    readers_[epoch & 1].fetch_sub(1, std::memory_order_release);
+    return snapshot;
 }
 
-Json::ObjectIterator& Json::ObjectIterator::operator=(ObjectIterator&& other) noexcept {
-    if (this != &other) {
-        impl_ = std::move(other.impl_);
+void Json::AtomicRef::Store(Json next) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    Publish(std::make_shared<const Json>(std::move(next)));
+}
+
+Json::AtomicRef::Snapshot Json::AtomicRef::Exchange(Json next) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    return Publish(std::make_shared<const Json>(std::move(next)));
+}
+
+bool Json::AtomicRef::CompareExchange(Snapshot& expected, Json desired) {
+    std::lock_guard<std::mutex> lock(writer_mutex_);
+    const Snapshot& current = *current_.load();
+    if (current != expected) {
+        expected = current;  // Safe: only writers free versions, and they hold the lock
+        return false;
     }
-    return *this;
+    Snapshot published = std::make_shared<const Json>(std::move(desired));
+    Publish(published);
+    expected = std::move(published);
+    return true;
 }
 
-Json::ObjectIterator::~ObjectIterator() = default;
+Json::AtomicRef::Snapshot Json::AtomicRef::Publish(Snapshot next) {
+    Snapshot* previous = current_.exchange(new Snapshot(std::move(next)));
 
-Json::ObjectIterator::ObjectIterator(Impl* json_impl) 
-    : impl_(std::make_unique<ObjectIterImpl>(json_impl->GetObject().begin(), json_impl->GetObject().end())) {}
+    // Readers that may still be copying *previous registered in the epoch
+    // being closed; later ones can only see the new version
+    const unsigned epoch = epoch_.fetch_add(1);
+    while (readers_[epoch & 1].load() != 0) {
+        std::this_thread::yield();
+    }
 
-Json::ObjectIterator::ObjectIterator(Impl* json_impl, bool end) {
-    if (end) {
-        impl_ = std::make_unique<ObjectIterImpl>();
-        impl_->it_ = json_impl->GetObject().end();
-        impl_->end_it_ = json_impl->GetObject().end();
-        impl_->valid_ = false;
-    } else {
-        impl_ = std::make_unique<ObjectIterImpl>(json_impl->GetObject().begin(), json_impl->GetObject().end());
+    Snapshot replaced = std::move(*previous);
+    delete previous;
+    return replaced;
+}
+
+// Numeric aggregations
+double Json::Sum() const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    return impl_->Summarize(nullptr).sum;
+}
+
+double Json::Sum(std::string_view field) const {
+    return Sum(Pointer(field));
+}
+
+double Json::Sum(const Pointer& field) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    return impl_->Summarize(&field).sum;
+}
+
+std::optional<double> Json::Min() const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto summary = impl_->Summarize(nullptr);
+    return summary.count ? std::optional<double>(summary.min) : std::nullopt;
+}
+
+std::optional<double> Json::Min(std::string_view field) const {
+    return Min(Pointer(field));
+}
+
+std::optional<double> Json::Min(const Pointer& field) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto summary = impl_->Summarize(&field);
+    return summary.count ? std::optional<double>(summary.min) : std::nullopt;
+}
+
+std::optional<double> Json::Max() const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto summary = impl_->Summarize(nullptr);
+    return summary.count ? std::optional<double>(summary.max) : std::nullopt;
+}
+
+std::optional<double> Json::Max(std::string_view field) const {
+    return Max(Pointer(field));
+}
+
+std::optional<double> Json::Max(const Pointer& field) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto summary = impl_->Summarize(&field);
+    return summary.count ? std::optional<double>(summary.max) : std::nullopt;
+}
+
+std::optional<double> Json::Mean() const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto summary = impl_->Summarize(nullptr);
+    return summary.count ? std::optional<double>(summary.sum / summary.count) : std::nullopt;
+}
+
+std::optional<double> Json::Mean(std::string_view field) const {
+    return Mean(Pointer(field));
+}
+
+std::optional<double> Json::Mean(const Pointer& field) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto summary = impl_->Summarize(&field);
+    return summary.count ? std::optional<double>(summary.sum / summary.count) : std::nullopt;
+}
+
+size_t Json::Count() const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    return impl_->Summarize(nullptr).count;
+}
+
+size_t Json::Count(std::string_view field) const {
+    return Count(Pointer(field));
+}
+
+size_t Json::Count(const Pointer& field) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    return impl_->Summarize(&field).count;
+}
+
+std::vector<double> Json::ExtractColumn(std::string_view field) const {
+    return ExtractColumn(Pointer(field));
+}
+
+std::vector<double> Json::ExtractColumn(const Pointer& field) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    std::vector<double> column;
+    impl_->ExtractColumn(field, column);
+    return column;
+}
+
+// Comparison and hashing
+bool Json::operator==(const Json& other) const noexcept {
+    if (!impl_ || !other.impl_) {
+        return impl_ == other.impl_;  // Moved-from objects only equal each other
     }
+    return impl_->Equals(*other.impl_);
 }
 
-Json::ObjectIterator& Json::ObjectIterator::operator++() {
-    if (impl_->valid_) {
-        ++impl_->it_;
-        impl_->Update();
+size_t Json::Hash() const noexcept {
+    return impl_ ? impl_->StructuralHash() : 0;
+}
+
+// Access sampling
+void Json::SampleObjectAccess(unsigned period) noexcept {
+    auto& sampler = Impl::SmartObject::access_sampler_;
+    sampler.stats.period = period;
+    sampler.countdown = period;
+}
+
+Json::AccessStats Json::ThreadAccessStats() noexcept {
+    return Impl::SmartObject::access_sampler_.stats;
+}
+
+void Json::ResetThreadAccessStats() noexcept {
+    auto& sampler = Impl::SmartObject::access_sampler_;
+    sampler.stats.lookups = 0;
+    sampler.stats.misses = 0;
+    sampler.countdown = sampler.stats.period;
+}
+
+// Serialization
+std::string Json::ToString(bool pretty) const {
+    ensure_valid();
+    return impl_->ToString(pretty);
+}
+
+// Bulk conversion
+template<JsonBulkScalar T>
+Json Json::FromContiguous(const T* data, size_t count) {
+    Json result = Array();
+    auto& arr = result.impl_->GetArray();
+    arr.reserve(count);  // Single reservation instead of per-PushBack growth checks
+    for (size_t i = 0; i < count; ++i) {
+        if constexpr (std::same_as<T, bool>) {
+            arr.emplace_back(data[i]);
+        } else if constexpr (std::same_as<T, std::string>) {
+            arr.emplace_back(std::string_view(data[i]));
+        } else {
+            arr.emplace_back(static_cast<double>(data[i]));
+        }
+    }
+    return result;
+}
+
+template<JsonBulkElement T>
+T Json::ConvertElement(const Json& element) {
+    element.ensure_valid();
+    const auto& value = element.impl_->data_->value_;
+    if constexpr (std::same_as<T, Json>) {
+        return element;
+    } else if constexpr (std::same_as<T, bool>) {
+        if (const bool* b = std::get_if<bool>(&value)) return *b;
+        throw JsonTypeError(Type::Boolean, element.GetType());
+    } else if constexpr (std::same_as<T, std::string>) {
+        if (const std::string* str = std::get_if<std::string>(&value)) return *str;
+        throw JsonTypeError(Type::String, element.GetType());
+    } else {
+        if (const Impl::Number* n = std::get_if<Impl::Number>(&value)) return static_cast<T>(*n);
+        throw JsonTypeError(Type::Number, element.GetType());
     }
-    return *this;
 }
 
-Json::ObjectIterator Json::ObjectIterator::operator++(int) {
-    ObjectIterator tmp(*this);
-    ++*this;
-    return tmp;
+template<JsonBulkElement T>
+void Json::CopyTo(std::vector<T>& out) const {
+    ensure_valid();
+    if (!IsArray()) throw JsonTypeError(Type::Array, GetType());
+    const auto& arr = std::as_const(*impl_).GetArray();
+    out.clear();
+    out.reserve(arr.size());
+    for (const Json& element : arr) {
+        out.push_back(ConvertElement<T>(element));
+    }
 }
 
-Json::ObjectIterator::reference Json::ObjectIterator::operator*() {
-    return impl_->current_;
+template<JsonBulkElement T>
+void Json::CopyTo(std::map<std::string, T>& out) const {
+    ensure_valid();
+    if (!IsObject()) throw JsonTypeError(Type::Object, GetType());
+    out.clear();
+    for (const auto& [key, value] : std::as_const(*impl_).GetObject()) {
+        out.emplace(key, ConvertElement<T>(value));
+    }
 }
 
-Json::KeyValue* Json::ObjectIterator::operator->() {
-    return &impl_->current_;
+template<JsonBulkElement T>
+void Json::CopyTo(std::unordered_map<std::string, T>& out) const {
+    ensure_valid();
+    if (!IsObject()) throw JsonTypeError(Type::Object, GetType());
+    const auto& obj = std::as_const(*impl_).GetObject();
+    out.clear();
+    out.reserve(obj.size());
+    for (const auto& [key, value] : obj) {
+        out.emplace(key, ConvertElement<T>(value));
+    }
 }
 
-bool Json::ObjectIterator::operator==(const ObjectIterator& other) const noexcept {
-    return impl_->it_ == other.impl_->it_;
+// Parallel algorithm support
+namespace {
+
+// Shared pool behind the Parallel* algorithms. A job is a number of chunks
+// claimed one at a time from an atomic cursor, so fast threads keep taking
+// work while slow ones finish theirs. The submitting thread works on its own
+// job too, and several jobs may be in flight from different threads.
+class ParallelPool {
+public:
+    static ParallelPool& Instance() {
+        static ParallelPool pool;
+        return pool;
+    }
+
+    [[nodiscard]] size_t Concurrency() const noexcept { return workers_.size() + 1; }
+
+    // True on pool threads and on callers while their job runs
+    static bool InTask() noexcept { return in_task_; }
+
+    void Run(size_t chunks, const std::function<void(size_t)>& task) {
+        auto job = std::make_shared<Job>(chunks, task);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            jobs_.push_back(job);
+        }
+        cv_.notify_all();
+
+        in_task_ = true;
+        Work(*job);
+        in_task_ = false;
+
+        std::exception_ptr error;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            std::erase(jobs_, job);
+            done_cv_.wait(lock, [&] { return job->finished == job->chunks; });
+            error = std::move(job->error);  // A worker may still hold the job
+        }
+        if (error) std::rethrow_exception(error);
+    }
+
+private:
+    struct Job {
+        Job(size_t count, const std::function<void(size_t)>& fn) : chunks(count), task(fn) {}
+        const size_t chunks;
+        const std::function<void(size_t)>& task;
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        size_t finished = 0;  // Guarded by the pool mutex
+        std::exception_ptr error;  // First exception, guarded by the pool mutex
+    };
+
+    ParallelPool() {
+        const unsigned hardware = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned i = 1; i < hardware; ++i) {
+            workers_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ~ParallelPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) worker.join();
+    }
+
+    void WorkerLoop() {
+        in_task_ = true;
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (true) {
+            cv_.wait(lock, [this] { return stop_ || !jobs_.empty(); });
+            if (stop_) return;
+            std::shared_ptr<Job> job = jobs_.front();
+            lock.unlock();
+            Work(*job);
+            lock.lock();
+            // Drained jobs leave the queue so idle workers go back to sleep
+            if (!jobs_.empty() && jobs_.front() == job) jobs_.pop_front();
+        }
+    }
+
+    void Work(Job& job) {
+        size_t completed = 0;
+        std::exception_ptr error;
+        for (size_t chunk = job.next.fetch_add(1, std::memory_order_relaxed); chunk < job.chunks;
+             chunk = job.next.fetch_add(1, std::memory_order_relaxed)) {
+            if (!job.failed.load(std::memory_order_relaxed)) {
+                try {
+                    job.task(chunk);
+                } catch (...) {
+                    if (!error) error = std::current_exception();
+                    job.failed.store(true, std::memory_order_relaxed);
+                }
+            }
+            ++completed;
+        }
+        if (completed == 0) return;
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (error && !job.error) job.error = error;
+        job.finished += completed;
+        if (job.finished == job.chunks) done_cv_.notify_all();
+    }
+
+    std::vector<std::thread> workers_;
+    std::deque<std::shared_ptr<Job>> jobs_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::condition_variable done_cv_;
+    bool stop_ = false;
+    static thread_local bool in_task_;
+};
+
+thread_local bool ParallelPool::in_task_ = false;
+
+constexpr size_t kMinParallelChunk = 16;  // Below this, waking the pool costs more than it saves
+
+} // namespace
+
+size_t Json::ParallelChunkSize(size_t count) noexcept {
+    // Several chunks per thread so uneven per-element work still balances
+    const size_t target_chunks = ParallelPool::Instance().Concurrency() * 8;
+    return std::max(kMinParallelChunk, (count + target_chunks - 1) / target_chunks);
 }
 
-bool Json::ObjectIterator::operator!=(const ObjectIterator& other) const noexcept {
-    return !(*this == other);
+void Json::RunParallel(size_t count, size_t chunk, const std::function<void(size_t, size_t)>& body) {
+    if (count == 0) return;
+    const size_t chunks = (count + chunk - 1) / chunk;
+    if (chunks == 1 || ParallelPool::InTask() || ParallelPool::Instance().Concurrency() == 1) {
+        // Nested calls and small inputs run inline; chunk boundaries are kept
+        // so per-chunk callers (ParallelReduce) see the same layout
+        for (size_t begin = 0; begin < count; begin += chunk) {
+            body(begin, std::min(count, begin + chunk));
+        }
+        return;
+    }
+    ParallelPool::Instance().Run(chunks, [&](size_t index) {
+        const size_t begin = index * chunk;
+        body(begin, std::min(count, begin + chunk));
+    });
+}
+
+// Group-by aggregation
+namespace {
+
+struct FieldStats {
+    size_t count = 0;
+    double sum = 0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+
+    void Add(double value) noexcept {
+        ++count;
+        sum += value;
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+
+    void Merge(const FieldStats& other) noexcept {
+        count += other.count;
+        sum += other.sum;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+};
+
+struct GroupStats {
+    size_t first = 0;  // Position of the group's first element, for output order
+    size_t count = 0;
+    std::vector<FieldStats> fields;
+};
+
+// Group keys point at the key values inside the source array and compare
+// structurally, so 5 and "5", or null and a missing key (nullptr), differ
+struct GroupKeyHash {
+    size_t operator()(const Json* key) const noexcept { return key ? key->Hash() : 0; }
+};
+
+struct GroupKeyEqual {
+    bool operator()(const Json* lhs, const Json* rhs) const noexcept {
+        return lhs == rhs || (lhs && rhs && *lhs == *rhs);
+    }
+};
+
+// One aggregation table per chunk
+using GroupTable = std::unordered_map<const Json*, GroupStats, GroupKeyHash, GroupKeyEqual>;
+
+} // namespace
+
+Json Json::GroupBy(const Json& array, std::string_view key_path,
+                   std::initializer_list<std::string_view> value_fields) {
+    return GroupBy(array, Pointer(key_path), value_fields);
 }
 
-// Const Object Iterator implementations
-Json::ConstObjectIterator::ConstObjectIterator() noexcept 
-    : impl_(std::make_unique<ConstObjectIterImpl>()) {}
+Json Json::GroupBy(const Json& array, const Pointer& key_path,
+                   std::initializer_list<std::string_view> value_fields) {
+    if (!array.IsArray()) ThrowTypeError(Type::Array, array.GetType());
+    std::span<const Json> items = array.Elements();
 
-Json::ConstObjectIterator::ConstObjectIterator(const ConstObjectIterator& other) 
-    : impl_(std::make_unique<ConstObjectIterImpl>(*other.impl_)) {}
+    // Hash every field name once, not once per row
+    std::vector<KeyView> fields;
+    fields.reserve(value_fields.size());
+    for (std::string_view field : value_fields) fields.emplace_back(field);
 
-Json::ConstObjectIterator::ConstObjectIterator(ConstObjectIterator&& other) noexcept 
-    : impl_(std::move(other.impl_)) {}
+    const size_t chunk = ParallelChunkSize(items.size());
+    std::vector<GroupTable> partials(items.empty() ? 0 : (items.size() + chunk - 1) / chunk);
+    RunParallel(items.size(), chunk, [&](size_t begin, size_t end) {
+        GroupTable& table = partials[begin / chunk];
+        for (size_t i = begin; i < end; ++i) {
+            const Json& element = items[i];
+            if (!element.IsObject()) ThrowTypeError(Type::Object, element.GetType());
 
-Json::ConstObjectIterator& Json::ConstObjectIterator::operator=(const ConstObjectIterator& other) {
-    if (this != &other) {
-        impl_ = std::make_unique<ConstObjectIterImpl>(*other.impl_);
+            auto [it, inserted] = table.try_emplace(element.Find(key_path));
+            GroupStats& group = it->second;
+            if (inserted) {
+                group.first = i;
+                group.fields.resize(fields.size());
+            }
+            ++group.count;
+            for (size_t f = 0; f < fields.size(); ++f) {
+                const Json* value = element.Find(fields[f]);
+                if (const double* number = value ? value->GetIf<double>() : nullptr) {
+                    group.fields[f].Add(*number);
+                }
+            }
+        }
+    });
+
+    // Merge the partials into the first table; partials are in element order,
+    // so the first position seen for a group is its earliest
+    GroupTable merged;
+    GroupTable& total = partials.empty() ? merged : partials.front();
+    for (size_t p = 1; p < partials.size(); ++p) {
+        for (auto& [key, stats] : partials[p]) {
+            auto [it, inserted] = total.try_emplace(key, std::move(stats));
+            if (inserted) continue;
+            it->second.count += stats.count;
+            for (size_t f = 0; f < fields.size(); ++f) it->second.fields[f].Merge(stats.fields[f]);
+        }
     }
-    return *this;
+
+    std::vector<std::pair<const Json*, const GroupStats*>> ordered;
+    ordered.reserve(total.size());
+    for (const auto& [key, stats] : total) ordered.emplace_back(key, &stats);
+    std::sort(ordered.begin(), ordered.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.second->first < rhs.second->first; });
+
+    Json result = Array();
+    result.Reserve(ordered.size());
+    for (const auto& [key, stats] : ordered) {
+        Json group = Object();
+        if (key) group["key"] = *key;  // Absent for elements without the key
+        group["count"] = static_cast<double>(stats->count);
+        Json summaries = Object();
+        summaries.Reserve(fields.size());
+        for (size_t f = 0; f < fields.size(); ++f) {
+            const FieldStats& field = stats->fields[f];
+            Json summary = Object();
+            summary["count"] = static_cast<double>(field.count);
+            summary["sum"] = field.sum;
+            summary["min"] = field.count ? Json(field.min) : Json();
+            summary["max"] = field.count ? Json(field.max) : Json();
+            summaries[fields[f]] = std::move(summary);
+        }
+        group["fields"] = std::move(summaries);
+        result.PushBack(std::move(group));
+    }
+    return result;
 }
 
-Json::ConstObjectIterator& Json::ConstObjectIterator::operator=(ConstObjectIterator&& other) noexcept {
-    if (this != &other) {
-        impl_ = std::move(other.impl_);
+// Key-extracting sort and dedupe
+namespace {
+
+// Flat sort key: a type rank plus the number or a view of the string, so
+// comparisons never touch the elements themselves
+struct SortKey {
+    uint8_t rank = 0;
+    double number = 0;
+    std::string_view text;
+    size_t position = 0;
+};
+
+SortKey MakeSortKey(const Json* value, size_t position) {
+    SortKey key;
+    key.position = position;
+    if (!value) return key;  // Missing field ranks first
+    switch (value->GetType()) {
+        case Json::Type::Null: key.rank = 1; break;
+        case Json::Type::Boolean: key.rank = 2; key.number = value->Get<bool>() ? 1 : 0; break;
+        case Json::Type::Number:
+            key.number = *value->GetIf<double>();
+            key.rank = std::isnan(key.number) ? 4 : 3;  // NaN compares unordered, so it ranks on its own
+            if (key.rank == 4) key.number = 0;
+            break;
+        case Json::Type::String: key.rank = 5; key.text = *value->GetIf<std::string>(); break;
+        case Json::Type::Array: key.rank = 6; break;
+        case Json::Type::Object: key.rank = 7; break;
     }
-    return *this;
+    return key;
 }
 
-Json::ConstObjectIterator::~ConstObjectIterator() = default;
+// Ties fall back to the original position, which makes the sort stable
+template<bool Descending>
+struct SortKeyLess {
+    bool operator()(const SortKey& a, const SortKey& b) const noexcept {
+        if (a.rank != b.rank) return Descending ? b.rank < a.rank : a.rank < b.rank;
+        if (a.number != b.number) return Descending ? b.number < a.number : a.number < b.number;
+        if (a.text != b.text) return Descending ? b.text < a.text : a.text < b.text;
+        return a.position < b.position;
+    }
+};
+
+constexpr size_t kMinParallelSort = 1 << 14;
 
-Json::ConstObjectIterator::ConstObjectIterator(const ObjectIterator& it) noexcept
-    : impl_(std::make_unique<ConstObjectIterImpl>()) {
-    impl_->it_ = it.impl_->it_;
-    impl_->end_it_ = it.impl_->end_it_;
-    impl_->valid_ = it.impl_->valid_;
-    if (impl_->valid_) {
-        impl_->Update();
+// Sorts chunks in parallel, then merges neighbouring runs round by round
+template<typename Less>
+void SortKeys(std::vector<SortKey>& keys, Less less,
+              const std::function<void(size_t, size_t, const std::function<void(size_t, size_t)>&)>& run) {
+    const size_t n = keys.size();
+    if (n < kMinParallelSort) {
+        std::sort(keys.begin(), keys.end(), less);
+        return;
+    }
+    const size_t chunk = std::max(kMinParallelSort / 4, (n + 15) / 16);
+    run(n, chunk, [&](size_t begin, size_t end) {
+        std::sort(keys.begin() + static_cast<std::ptrdiff_t>(begin), keys.begin() + static_cast<std::ptrdiff_t>(end), less);
+    });
+
+    std::vector<SortKey> buffer(n);
+    for (size_t width = chunk; width < n; width *= 2) {
+        const size_t pairs = (n + 2 * width - 1) / (2 * width);
+        run(pairs, 1, [&](size_t first, size_t last) {
+            for (size_t pair = first; pair < last; ++pair) {
+                const size_t lo = pair * 2 * width;
+                const size_t mid = std::min(n, lo + width);
+                const size_t hi = std::min(n, lo + 2 * width);
+                std::merge(keys.begin() + static_cast<std::ptrdiff_t>(lo), keys.begin() + static_cast<std::ptrdiff_t>(mid),
+                           keys.begin() + static_cast<std::ptrdiff_t>(mid), keys.begin() + static_cast<std::ptrdiff_t>(hi),
+                           buffer.begin() + static_cast<std::ptrdiff_t>(lo), less);
+            }
+        });
+        keys.swap(buffer);
     }
 }
 
-Json::ConstObjectIterator::ConstObjectIterator(const Impl* json_impl) 
-    : impl_(std::make_unique<ConstObjectIterImpl>(json_impl->GetObject().begin(), json_impl->GetObject().end())) {}
+struct FieldHash {
+    size_t operator()(const Json* value) const noexcept { return value ? value->Hash() : 0; }
+};
+
+struct FieldEqual {
+    bool operator()(const Json* a, const Json* b) const noexcept { return a && b ? *a == *b : a == b; }
+};
 
-Json::ConstObjectIterator::ConstObjectIterator(const Impl* json_impl, bool end) {
-    if (end) {
-        impl_ = std::make_unique<ConstObjectIterImpl>();
-        impl_->it_ = json_impl->GetObject().end();
-        impl_->end_it_ = json_impl->GetObject().end();
-        impl_->valid_ = false;
+} // namespace
+
+void Json::SortBy(std::string_view field, SortOrder order) {
+    SortBy(Pointer(field), order);
+}
+
+void Json::SortBy(const Pointer& field, SortOrder order) {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto& arr = impl_->GetArray();  // Unshare first so the keys view the storage being permuted
+    const size_t n = arr.size();
+
+    std::vector<SortKey> keys(n);
+    RunParallel(n, ParallelChunkSize(n), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) keys[i] = MakeSortKey(std::as_const(arr[i]).Find(field), i);
+    });
+    if (order == SortOrder::Ascending) {
+        SortKeys(keys, SortKeyLess<false>(), RunParallel);
     } else {
-        impl_ = std::make_unique<ConstObjectIterImpl>(json_impl->GetObject().begin(), json_impl->GetObject().end());
+        SortKeys(keys, SortKeyLess<true>(), RunParallel);
+    }
+
+    Impl::Array sorted;
+    sorted.reserve(n);
+    for (const auto& key : keys) sorted.push_back(std::move(arr[key.position]));
+    arr.swap(sorted);
+
+    if (impl_->track_) [[unlikely]] {
+        std::vector<size_t> order(n);
+        for (size_t i = 0; i < n; ++i) order[i] = keys[i].position;
+        ChangeTracker::RecordPermutation(*impl_, order);
     }
 }
 
-Json::ConstObjectIterator& Json::ConstObjectIterator::operator++() {
-    if (impl_->valid_) {
-        ++impl_->it_;
-        impl_->Update();
+size_t Json::UniqueBy(std::string_view field) {
+    return UniqueBy(Pointer(field));
+}
+
+size_t Json::UniqueBy(const Pointer& field) {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto& arr = impl_->GetArray();
+    const size_t n = arr.size();
+
+    // Decide first, move afterwards: the set holds pointers into the elements
+    std::vector<char> keep(n);
+    {
+        std::unordered_set<const Json*, FieldHash, FieldEqual> seen;
+        seen.reserve(n);
+        for (size_t i = 0; i < n; ++i) keep[i] = seen.insert(std::as_const(arr[i]).Find(field)).second;
     }
-    return *this;
+
+    // Move-construct the survivors into fresh storage, as SortBy does;
+    // assigning over tracked elements would record each move
+    Impl::Array unique;
+    unique.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (keep[i]) unique.push_back(std::move(arr[i]));
+    }
+    arr.swap(unique);
+
+    const size_t removed = n - arr.size();
+    if (removed != 0 && impl_->track_) [[unlikely]] {
+        size_t shift = 0;  // Earlier removals move later elements down
+        for (size_t i = 0; i < n; ++i) {
+            if (!keep[i]) ChangeTracker::Record(*impl_, ChangeTracker::Op::Remove, std::to_string(i - shift++), nullptr);
+        }
+    }
+    return removed;
 }
 
-Json::ConstObjectIterator Json::ConstObjectIterator::operator++(int) {
-    ConstObjectIterator tmp(*this);
-    ++*this;
-    return tmp;
+// Secondary indexes
+Json::Index Json::BuildIndex(std::string_view field) {
+    return BuildIndex(Pointer(field));
 }
 
-Json::ConstObjectIterator::reference Json::ConstObjectIterator::operator*() {
-    return impl_->current_;
+Json::Index Json::BuildIndex(const Pointer& field) {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    auto state = std::make_shared<Index::State>(field);
+    impl_->AttachIndex(state);
+    state->Rebuild();
+    return Index(std::move(state));
 }
 
-Json::ConstKeyValue* Json::ConstObjectIterator::operator->() {
-    return &impl_->current_;
+const Json::Index::State& Json::Index::Current() const {
+    if (!state_ || !state_->owner) {
+        throw JsonException("Index is not attached to an array");
+    }
+    if (state_->stale) state_->Rebuild();
+    return *state_;
+}
+
+std::optional<size_t> Json::Index::Find(const Json& value) const {
+    const State& state = Current();
+    const auto& arr = std::as_const(*state.owner).GetArray();
+    std::optional<size_t> best;
+    auto [first, last] = state.positions.equal_range(value.Hash());
+    for (auto it = first; it != last; ++it) {
+        const size_t position = it->second;
+        if (best && *best < position) continue;
+        const Json* field = arr[position].Find(state.field);
+        if (field && *field == value) best = position;
+    }
+    return best;
 }
 
-bool Json::ConstObjectIterator::operator==(const ConstObjectIterator& other) const noexcept {
-    return impl_->it_ == other.impl_->it_;
+std::vector<size_t> Json::Index::FindAll(const Json& value) const {
+    const State& state = Current();
+    const auto& arr = std::as_const(*state.owner).GetArray();
+    std::vector<size_t> out;
+    auto [first, last] = state.positions.equal_range(value.Hash());
+    for (auto it = first; it != last; ++it) {
+        const Json* field = arr[it->second].Find(state.field);
+        if (field && *field == value) out.push_back(it->second);
+    }
+    std::sort(out.begin(), out.end());
+    return out;
 }
 
-bool Json::ConstObjectIterator::operator!=(const ConstObjectIterator& other) const noexcept {
-    return !(*this == other);
+bool Json::Index::Attached() const noexcept {
+    return state_ && state_->owner;
 }
 
+const Json::Pointer& Json::Index::Field() const {
+    if (!state_) {
+        throw JsonException("Index is not attached to an array");
+    }
+    return state_->field;
+}
+
+// Exception implementations
+// Validity check implementation (cold paths of the inline accessors)
+void Json::ThrowInvalid() {
+    throw JsonException("Operation on moved-from or invalid Json object");
+}
+
+void Json::ThrowTypeError(Type expected, Type actual) {
+    throw JsonTypeError(expected, actual);
+}
+
+JsonException::JsonException(const std::string& message) : std::runtime_error(message) {}
+JsonException::JsonException(const char* message) : std::runtime_error(message) {}
+
+JsonTypeError::JsonTypeError(Json::Type expected, Json::Type actual) 
+    : JsonException("Type mismatch: expected " + std::to_string(static_cast<int>(expected)) + 
+                   ", got " + std::to_string(static_cast<int>(actual))) {}
+
+JsonParseError::JsonParseError(const std::string& message, size_t line, size_t column)
+    : JsonException(message + " at line " + std::to_string(line) + ", column " + std::to_string(column))
+    , line_(line)
+    , column_(column) {}
+
+size_t JsonParseError::Line() const noexcept { return line_; }
+size_t JsonParseError::Column() const noexcept { return column_; }
+
 // Array iteration methods
-Json::Iterator Json::begin() noexcept {
-    if (!impl_) return Iterator(nullptr, 0); // Safe default for moved-from objects
-    if (!IsArray() && !IsObject()) return Iterator(impl_.get(), 0); // Empty range for non-arrays/objects
-    return Iterator(impl_.get(), 0);
+Json::Iterator Json::begin() {
+    if (!IsArray()) return Iterator(); // Empty range for moved-from objects and non-arrays
+    auto& arr = impl_->GetArray();
+    if (impl_->track_) [[unlikely]] ChangeTracker::TrackChildren(*impl_);
+    return Iterator(arr.data());
 }
 
-Json::Iterator Json::end() noexcept {
-    if (!impl_) return Iterator(nullptr, 0); // Safe default for moved-from objects
-    if (!IsArray() && !IsObject()) return Iterator(impl_.get(), 0); // Empty range for non-arrays/objects
-    return Iterator(impl_.get(), Size());
+Json::Iterator Json::end() {
+    if (!IsArray()) return Iterator();
+    auto& arr = impl_->GetArray();
+    return Iterator(arr.data() + arr.size());
 }
 
 Json::ConstIterator Json::begin() const noexcept {
-    if (!impl_) return ConstIterator(nullptr, 0); // Safe default for moved-from objects
-    if (!IsArray() && !IsObject()) return ConstIterator(impl_.get(), 0); // Empty range for non-arrays/objects
-    return ConstIterator(impl_.get(), 0);
+    if (!IsArray()) return ConstIterator(); // Empty range for moved-from objects and non-arrays
+    return ConstIterator(std::as_const(*impl_).GetArray().data());
 }
 
 Json::ConstIterator Json::end() const noexcept {
-    if (!impl_) return ConstIterator(nullptr, 0); // Safe default for moved-from objects
-    if (!IsArray() && !IsObject()) return ConstIterator(impl_.get(), 0); // Empty range for non-arrays/objects
-    return ConstIterator(impl_.get(), Size());
+    if (!IsArray()) return ConstIterator();
+    const auto& arr = std::as_const(*impl_).GetArray();
+    return ConstIterator(arr.data() + arr.size());
 }
 
 Json::ConstIterator Json::cbegin() const noexcept {
@@ -821,25 +1922,39 @@ Json::ConstIterator Json::cend() const noexcept {
     return end();
 }
 
+std::span<Json> Json::Elements() {
+    if (!IsArray()) return {};
+    auto& arr = impl_->GetArray();
+    if (impl_->track_) [[unlikely]] ChangeTracker::TrackChildren(*impl_);
+    return arr;
+}
+
+std::span<const Json> Json::Elements() const noexcept {
+    if (!IsArray()) return {};
+    return std::as_const(*impl_).GetArray();
+}
+
 // Object iteration methods
-Json::ObjectIterator Json::object_begin() noexcept {
-    if (!impl_) return ObjectIterator(); // Safe default for moved-from objects
-    return ObjectIterator(impl_.get());
+Json::ObjectIterator Json::object_begin() {
+    if (!IsObject()) return ObjectIterator(); // Empty range for moved-from objects and non-objects
+    auto& obj = impl_->GetObject();
+    if (impl_->track_) [[unlikely]] ChangeTracker::TrackChildren(*impl_);
+    return ObjectIterator(obj.begin());
 }
 
-Json::ObjectIterator Json::object_end() noexcept {
-    if (!impl_) return ObjectIterator(); // Safe default for moved-from objects
-    return ObjectIterator(impl_.get(), true);
+Json::ObjectIterator Json::object_end() {
+    if (!IsObject()) return ObjectIterator();
+    return ObjectIterator(impl_->GetObject().end());
 }
 
 Json::ConstObjectIterator Json::object_begin() const noexcept {
-    if (!impl_) return ConstObjectIterator(); // Safe default for moved-from objects
-    return ConstObjectIterator(impl_.get());
+    if (!IsObject()) return ConstObjectIterator(); // Empty range for moved-from objects and non-objects
+    return ConstObjectIterator(std::as_const(*impl_).GetObject().begin());
 }
 
 Json::ConstObjectIterator Json::object_end() const noexcept {
-    if (!impl_) return ConstObjectIterator(); // Safe default for moved-from objects
-    return ConstObjectIterator(impl_.get(), true);
+    if (!IsObject()) return ConstObjectIterator();
+    return ConstObjectIterator(std::as_const(*impl_).GetObject().end());
 }
 
 Json::ConstObjectIterator Json::object_cbegin() const noexcept {
@@ -851,62 +1966,23 @@ Json::ConstObjectIterator Json::object_cend() const noexcept {
 }
 
 // Range helper implementations
-Json::ObjectIterator Json::ObjectRange::begin() noexcept {
-    if (!json_.IsObject()) {
-        // Return empty iterator instead of crashing
-        return ObjectIterator();
-    }
-    return json_.object_begin();
+Json::ObjectIterator Json::ObjectRange::begin() const {
+    return json_ ? json_->object_begin() : ObjectIterator();
 }
 
-Json::ObjectIterator Json::ObjectRange::end() noexcept {
-    if (!json_.IsObject()) {
-        return ObjectIterator(); // Empty range
-    }
-    return json_.object_end();
+Json::ObjectIterator Json::ObjectRange::end() const {
+    return json_ ? json_->object_end() : ObjectIterator();
 }
 
 Json::ConstObjectIterator Json::ConstObjectRange::begin() const noexcept {
-    if (!json_.IsObject()) {
-        // Return empty iterator instead of crashing
-        return ConstObjectIterator();
-    }
-    return json_.object_begin();
+    return json_ ? json_->object_begin() : ConstObjectIterator();
 }
 
 Json::ConstObjectIterator Json::ConstObjectRange::end() const noexcept {
-    if (!json_.IsObject()) {
-        return ConstObjectIterator(); // Empty range
-    }
-    return json_.object_end();
+    return json_ ? json_->object_end() : ConstObjectIterator();
 }
 
 // Template method definitions (moved from JsonTemplates.h)
-template<typename T>
-requires std::same_as<T, bool> ||
-         std::integral<T> ||
-         std::floating_point<T> ||
-         std::convertible_to<T, std::string_view>
-T Json::Get() const {
-    ensure_valid(); // Add validity check
-    if constexpr (std::same_as<T, bool>) {
-        if (!IsBoolean()) throw JsonTypeError(Type::Boolean, GetType());
-        return impl_->GetBoolean();
-    }
-    else if constexpr (std::integral<T>) {
-        if (!IsNumber()) throw JsonTypeError(Type::Number, GetType());
-        return static_cast<T>(impl_->GetNumber());
-    }
-    else if constexpr (std::floating_point<T>) {
-        if (!IsNumber()) throw JsonTypeError(Type::Number, GetType());
-        return static_cast<T>(impl_->GetNumber());
-    }
-    else if constexpr (std::convertible_to<T, std::string_view>) {
-        if (!IsString()) throw JsonTypeError(Type::String, GetType());
-        return impl_->GetString();
-    }
-}
-
 template<typename T>
 requires std::same_as<T, bool> ||
          std::integral<T> ||
@@ -923,35 +1999,12 @@ void Json::Set(T value) {
     else if constexpr (std::convertible_to<T, std::string_view>) {
         impl_->SetString(std::string(value));
     }
-}
-
-template<typename T>
-std::optional<T> Json::TryGet() const noexcept {
-    try {
-        if (!impl_) return std::nullopt; // Safe default for moved-from objects
-        return Get<T>();
-    } catch (const JsonTypeError&) {
-        return std::nullopt;
-    } catch (const JsonException&) { // Catch validity check exceptions too
-        return std::nullopt;
-    }
+    if (impl_->track_) [[unlikely]] ChangeTracker::Record(*impl_, *this);
 }
 
 // Explicit template instantiations for commonly used types
 // This ensures the templates are compiled into the library
 
-// Get<T> instantiations
-template bool Json::Get<bool>() const;
-template int Json::Get<int>() const;
-template long Json::Get<long>() const;
-template long long Json::Get<long long>() const;
-template unsigned int Json::Get<unsigned int>() const;
-template unsigned long Json::Get<unsigned long>() const;
-template unsigned long long Json::Get<unsigned long long>() const;
-template float Json::Get<float>() const;
-template double Json::Get<double>() const;
-template std::string Json::Get<std::string>() const;
-
 // Set<T> instantiations
 template void Json::Set<bool>(bool);
 template void Json::Set<int>(int);
@@ -966,14 +2019,51 @@ template void Json::Set<std::string>(std::string);
 template void Json::Set<const char*>(const char*);
 template void Json::Set<std::string_view>(std::string_view);
 
-// TryGet<T> instantiations
-template std::optional<bool> Json::TryGet<bool>() const noexcept;
-template std::optional<int> Json::TryGet<int>() const noexcept;
-template std::optional<long> Json::TryGet<long>() const noexcept;
-template std::optional<long long> Json::TryGet<long long>() const noexcept;
-template std::optional<unsigned int> Json::TryGet<unsigned int>() const noexcept;
-template std::optional<unsigned long> Json::TryGet<unsigned long>() const noexcept;
-template std::optional<unsigned long long> Json::TryGet<unsigned long long>() const noexcept;
-template std::optional<float> Json::TryGet<float>() const noexcept;
-template std::optional<double> Json::TryGet<double>() const noexcept;
-template std::optional<std::string> Json::TryGet<std::string>() const noexcept;
+// FromContiguous<T> instantiations
+template Json Json::FromContiguous<bool>(const bool*, size_t);
+template Json Json::FromContiguous<int>(const int*, size_t);
+template Json Json::FromContiguous<long>(const long*, size_t);
+template Json Json::FromContiguous<long long>(const long long*, size_t);
+template Json Json::FromContiguous<unsigned int>(const unsigned int*, size_t);
+template Json Json::FromContiguous<unsigned long>(const unsigned long*, size_t);
+template Json Json::FromContiguous<unsigned long long>(const unsigned long long*, size_t);
+template Json Json::FromContiguous<float>(const float*, size_t);
+template Json Json::FromContiguous<double>(const double*, size_t);
+template Json Json::FromContiguous<std::string>(const std::string*, size_t);
+
+// CopyTo<T> instantiations
+template void Json::CopyTo<bool>(std::vector<bool>&) const;
+template void Json::CopyTo<int>(std::vector<int>&) const;
+template void Json::CopyTo<long>(std::vector<long>&) const;
+template void Json::CopyTo<long long>(std::vector<long long>&) const;
+template void Json::CopyTo<unsigned int>(std::vector<unsigned int>&) const;
+template void Json::CopyTo<unsigned long>(std::vector<unsigned long>&) const;
+template void Json::CopyTo<unsigned long long>(std::vector<unsigned long long>&) const;
+template void Json::CopyTo<float>(std::vector<float>&) const;
+template void Json::CopyTo<double>(std::vector<double>&) const;
+template void Json::CopyTo<std::string>(std::vector<std::string>&) const;
+template void Json::CopyTo<Json>(std::vector<Json>&) const;
+
+template void Json::CopyTo<bool>(std::map<std::string, bool>&) const;
+template void Json::CopyTo<int>(std::map<std::string, int>&) const;
+template void Json::CopyTo<long>(std::map<std::string, long>&) const;
+template void Json::CopyTo<long long>(std::map<std::string, long long>&) const;
+template void Json::CopyTo<unsigned int>(std::map<std::string, unsigned int>&) const;
+template void Json::CopyTo<unsigned long>(std::map<std::string, unsigned long>&) const;
+template void Json::CopyTo<unsigned long long>(std::map<std::string, unsigned long long>&) const;
+template void Json::CopyTo<float>(std::map<std::string, float>&) const;
+template void Json::CopyTo<double>(std::map<std::string, double>&) const;
+template void Json::CopyTo<std::string>(std::map<std::string, std::string>&) const;
+template void Json::CopyTo<Json>(std::map<std::string, Json>&) const;
+
+template void Json::CopyTo<bool>(std::unordered_map<std::string, bool>&) const;
+template void Json::CopyTo<int>(std::unordered_map<std::string, int>&) const;
+template void Json::CopyTo<long>(std::unordered_map<std::string, long>&) const;
+template void Json::CopyTo<long long>(std::unordered_map<std::string, long long>&) const;
+template void Json::CopyTo<unsigned int>(std::unordered_map<std::string, unsigned int>&) const;
+template void Json::CopyTo<unsigned long>(std::unordered_map<std::string, unsigned long>&) const;
+template void Json::CopyTo<unsigned long long>(std::unordered_map<std::string, unsigned long long>&) const;
+template void Json::CopyTo<float>(std::unordered_map<std::string, float>&) const;
+template void Json::CopyTo<double>(std::unordered_map<std::string, double>&) const;
+template void Json::CopyTo<std::string>(std::unordered_map<std::string, std::string>&) const;
+template void Json::CopyTo<Json>(std::unordered_map<std::string, Json>&) const;
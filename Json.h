@@ -2,6 +2,7 @@
 #define JSON_H
 
 #include <string>
+#include <cstdint>
 #include <memory>
 #include <vector>
 #include <optional>
@@ -10,6 +11,18 @@
 #include <stdexcept>
 #include <iterator>
 #include <tuple>
+#include <map>
+#include <unordered_map>
+#include <ranges>
+#include <type_traits>
+#include <array>
+#include <bit>
+#include <span>
+#include <functional>
+#include <initializer_list>
+#include <iosfwd>
+#include <atomic>
+#include <mutex>
 
 // Forward declarations
 namespace detail {
@@ -23,6 +36,44 @@ namespace detail {
 
 // Forward declare exception class
 class JsonException;
+class Json;
+
+// Element types converted in a single reserved pass by Json::FromRange/CopyTo
+template<typename T>
+concept JsonBulkScalar = std::same_as<T, bool> ||
+                         std::same_as<T, int> ||
+                         std::same_as<T, long> ||
+                         std::same_as<T, long long> ||
+                         std::same_as<T, unsigned int> ||
+                         std::same_as<T, unsigned long> ||
+                         std::same_as<T, unsigned long long> ||
+                         std::same_as<T, float> ||
+                         std::same_as<T, double> ||
+                         std::same_as<T, std::string>;
+
+template<typename T>
+concept JsonBulkElement = JsonBulkScalar<T> || std::same_as<T, Json>;
+
+// Field descriptors for Json::Encode. Describe a struct by specializing
+// JsonFields, e.g.
+//   template<> struct JsonFields<Point> {
+//       static constexpr auto value = std::make_tuple(JsonField{"x", &Point::x},
+//                                                     JsonField{"y", &Point::y});
+//   };
+template<typename Class, typename Member>
+struct JsonField {
+    std::string_view name;
+    Member Class::* member;
+};
+
+template<typename Class, typename Member>
+JsonField(std::string_view, Member Class::*) -> JsonField<Class, Member>;
+
+template<typename T>
+struct JsonFields;
+
+template<typename T>
+concept JsonReflectable = requires { JsonFields<T>::value; };
 
 class Json {
 private:
@@ -43,6 +94,82 @@ public:
         Object
     };
 
+    // Object key with a precomputed hash. Lookups through a KeyView neither
+    // rehash nor allocate. Built from Key handles or the "name"_key literal.
+    class KeyView {
+    public:
+        constexpr KeyView(std::string_view name, size_t hash) noexcept : name_(name), hash_(hash) {}
+        constexpr explicit KeyView(std::string_view name) noexcept : name_(name), hash_(Hash(name)) {}
+
+        [[nodiscard]] constexpr std::string_view Name() const noexcept { return name_; }
+        [[nodiscard]] constexpr size_t HashValue() const noexcept { return hash_; }
+
+        // Hash used by object storage; constexpr so keys can be hashed at compile time
+        [[nodiscard]] static constexpr size_t Hash(std::string_view key) noexcept {
+            uint64_t h = 0x9E3779B97F4A7C15ull ^ key.size();
+            size_t i = 0;
+            for (; i + 8 <= key.size(); i += 8) {
+                uint64_t word = 0;
+                for (size_t b = 0; b < 8; ++b) {
+                    word |= static_cast<uint64_t>(static_cast<unsigned char>(key[i + b])) << (8 * b);
+                }
+                h = (h ^ word) * 0xFF51AFD7ED558CCDull;
+                h ^= h >> 32;
+            }
+            uint64_t tail = 0;
+            for (size_t b = 0; i + b < key.size(); ++b) {
+                tail |= static_cast<uint64_t>(static_cast<unsigned char>(key[i + b])) << (8 * b);
+            }
+            h = (h ^ tail) * 0xC4CEB9FE1A85EC53ull;
+            h ^= h >> 33;
+            h *= 0xFF51AFD7ED558CCDull;
+            h ^= h >> 33;
+            return static_cast<size_t>(h);
+        }
+
+    private:
+        std::string_view name_;
+        size_t hash_;
+    };
+
+    // Reusable owning key handle for repeated lookups in hot loops
+    class Key {
+    public:
+        explicit Key(std::string_view name) : name_(name), hash_(KeyView::Hash(name)) {}
+
+        [[nodiscard]] std::string_view Name() const noexcept { return name_; }
+        [[nodiscard]] size_t HashValue() const noexcept { return hash_; }
+        [[nodiscard]] static constexpr size_t Hash(std::string_view key) noexcept { return KeyView::Hash(key); }
+
+        operator KeyView() const noexcept { return KeyView(name_, hash_); }
+
+    private:
+        std::string name_;
+        size_t hash_;
+    };
+
+    // Perfect-hashed set of known keys, see Json::Schema below
+    template<size_t N>
+    class Schema;
+
+    template<typename... Keys>
+    Schema(Keys...) -> Schema<sizeof...(Keys)>;
+
+    // Precompiled RFC 6901 JSON Pointer, see Json::Pointer below
+    class Pointer;
+
+    // Compiled JSONPath query, see Json::Path below
+    class Path;
+
+    // Secondary hash index over an array of objects, see Json::Index below
+    class Index;
+
+    // Records changes to a document as JSON Patch, see Json::ChangeTracker below
+    class ChangeTracker;
+
+    // Atomically published immutable document, see Json::AtomicRef below
+    class AtomicRef;
+
     // Constructors
     Json() noexcept;  // Creates null
     Json(std::nullptr_t) noexcept;
@@ -96,7 +223,14 @@ public:
 
     // Safe access
     template<typename T>
-    [[nodiscard]] std::optional<T> TryGet() const noexcept;
+    [[nodiscard]] std::optional<T> TryGet() const noexcept;  // Never throws on mismatch
+
+    // Pointer to the stored value, or nullptr if the value holds another type
+    template<typename T>
+    requires std::same_as<T, bool> ||
+             std::same_as<T, double> ||
+             std::same_as<T, std::string>
+    [[nodiscard]] const T* GetIf() const noexcept;
 
     // Array operations
     Json& operator[](size_t index);
@@ -111,19 +245,210 @@ public:
     const Json& operator[](std::string_view key) const;
     [[nodiscard]] bool Contains(std::string_view key) const;
     void Remove(std::string_view key);
+    Json& operator[](KeyView key);
+    const Json& operator[](KeyView key) const;
+    [[nodiscard]] bool Contains(KeyView key) const;
+    void Remove(KeyView key);
+
+    // Non-throwing member lookup; nullptr if the key is absent or this is not an object
+    [[nodiscard]] const Json* Find(std::string_view key) const noexcept;
+    [[nodiscard]] const Json* Find(KeyView key) const noexcept;
+    [[nodiscard]] Json* Find(std::string_view key);
+    [[nodiscard]] Json* Find(KeyView key);
     [[nodiscard]] std::vector<std::string> Keys() const;
 
+    // JSON Pointer navigation. Find returns nullptr when the path does not
+    // resolve; At throws JsonException. Mutable access unshares only the
+    // values along a path that resolves.
+    [[nodiscard]] const Json* Find(const Pointer& pointer) const noexcept;
+    [[nodiscard]] Json* Find(const Pointer& pointer);
+    [[nodiscard]] const Json& At(const Pointer& pointer) const;
+    [[nodiscard]] Json& At(const Pointer& pointer);
+
+    // Applies an RFC 6902 JSON Patch (an array of add, remove, replace, move,
+    // copy and test operations) and returns the patched document. The result
+    // shares every untouched value with doc; only the containers along each
+    // modified path are copied. doc itself is never changed, so the patch is
+    // all-or-nothing: a failing operation throws JsonException naming it.
+    [[nodiscard]] static Json ApplyPatch(const Json& doc, const Json& patch);
+
+    // Applies an RFC 7386 JSON Merge Patch: objects merge recursively, null
+    // members remove keys, anything else replaces the target. Both arguments
+    // are taken by value, so moved-in targets are updated in place and patch
+    // values are moved into the result rather than copied:
+    //   config = Json::MergePatch(std::move(config), std::move(overlay));
+    [[nodiscard]] static Json MergePatch(Json target, Json patch);
+
+    // JSON Patch that turns a into b (ApplyPatch(a, Diff(a, b)) == b). Pairs
+    // of values that share storage, such as the untouched parts of a COW copy,
+    // are skipped without being looked at, so diffing two versions of a large
+    // document costs time proportional to what changed. Arrays are compared
+    // position by position, with trailing elements added or removed.
+    [[nodiscard]] static Json Diff(const Json& a, const Json& b);
+
+    // Lazy views over an object's members (empty for non-objects). KeysView()
+    // yields string_views into the stored names instead of copying them.
+    class KeyRange;
+    class ValueRange;
+    class ConstValueRange;
+    [[nodiscard]] KeyRange KeysView() const noexcept;
+    [[nodiscard]] ValueRange Values();  // Unshares a copy-on-write object first
+    [[nodiscard]] ConstValueRange Values() const noexcept;
+
+    // Bulk conversion to and from STL containers
+    template<std::ranges::input_range R>
+    [[nodiscard]] static Json FromRange(R&& range);
+
+    template<JsonBulkElement T>
+    void CopyTo(std::vector<T>& out) const;  // Replaces out with the array's elements
+    template<JsonBulkElement T>
+    void CopyTo(std::map<std::string, T>& out) const;  // Replaces out with the object's members
+    template<JsonBulkElement T>
+    void CopyTo(std::unordered_map<std::string, T>& out) const;
+
+    template<typename Container>
+    requires requires(const Json& json, Container& out) { json.CopyTo(out); }
+    [[nodiscard]] Container As() const {
+        Container out;
+        CopyTo(out);
+        return out;
+    }
+
+    // JSONPath query; results point into this document in match order and
+    // stay valid until the matched values are modified or destroyed
+    [[nodiscard]] std::vector<const Json*> Query(const Path& path) const;
+    void Query(const Path& path, std::vector<const Json*>& out) const;  // Appends to out
+
+    // Streaming JSONPath over JSON text: the path is matched while the text is
+    // scanned, only matching values are parsed into Json and passed to
+    // on_match (in document order), and everything else is skipped without
+    // being built. Steps that need a whole node to decide (filters, negative
+    // indices and slices) parse just that node. Matches come in document
+    // order, and a value selected more than once (e.g. by the union [0,0]) is
+    // passed once per selection, as in Query. Returns the number of matches;
+    // malformed input, skipped regions included, throws JsonParseError.
+    static size_t Scan(std::string_view text, const Path& path, const std::function<void(Json&&)>& on_match);
+    // Newline-delimited JSON: one document per non-blank line, reported with its 1-based line number
+    static size_t ScanLines(std::string_view text, const Path& path,
+                            const std::function<void(size_t line, Json&&)>& on_match);
+    static size_t ScanLines(std::istream& input, const Path& path,
+                            const std::function<void(size_t line, Json&&)>& on_match);
+
+    // Numeric aggregations over an array: of its elements, or of the value at
+    // field (a JSON Pointer relative to each element, e.g. "/price") in each.
+    // Non-numeric values and missing fields are skipped (Count() reports how
+    // many values took part); Min/Max/Mean are empty when none did.
+    // Non-arrays throw JsonTypeError.
+    [[nodiscard]] double Sum() const;
+    [[nodiscard]] double Sum(std::string_view field) const;
+    [[nodiscard]] double Sum(const Pointer& field) const;
+    [[nodiscard]] std::optional<double> Min() const;
+    [[nodiscard]] std::optional<double> Min(std::string_view field) const;
+    [[nodiscard]] std::optional<double> Min(const Pointer& field) const;
+    [[nodiscard]] std::optional<double> Max() const;
+    [[nodiscard]] std::optional<double> Max(std::string_view field) const;
+    [[nodiscard]] std::optional<double> Max(const Pointer& field) const;
+    [[nodiscard]] std::optional<double> Mean() const;
+    [[nodiscard]] std::optional<double> Mean(std::string_view field) const;
+    [[nodiscard]] std::optional<double> Mean(const Pointer& field) const;
+    [[nodiscard]] size_t Count() const;
+    [[nodiscard]] size_t Count(std::string_view field) const;
+    [[nodiscard]] size_t Count(const Pointer& field) const;
+
+    // The value at field (a JSON Pointer, as above) of every element, in
+    // order. Throws if an element has no value there or it is not a number.
+    [[nodiscard]] std::vector<double> ExtractColumn(std::string_view field) const;
+    [[nodiscard]] std::vector<double> ExtractColumn(const Pointer& field) const;
+
+    // Hash aggregation over an array of objects. Elements are grouped by the
+    // value at key_path (a JSON Pointer relative to each element, e.g.
+    // "/region"), compared structurally, so 5 and "5" form separate groups,
+    // and elements without the key form a group of their own. The result is
+    // an array of groups in order of first appearance:
+    //   {"key": value, "count": n, "fields": {"<field>": {"count", "sum", "min", "max"}}}
+    // with "key" absent for the missing-key group and one summary per entry
+    // of value_fields; non-numeric values are skipped as in Sum(). Large
+    // arrays are aggregated in parallel partials merged at the end.
+    [[nodiscard]] static Json GroupBy(const Json& array, std::string_view key_path,
+                                      std::initializer_list<std::string_view> value_fields = {});
+    [[nodiscard]] static Json GroupBy(const Json& array, const Pointer& key_path,
+                                      std::initializer_list<std::string_view> value_fields = {});
+
+    // Hash index from the value at field (a JSON Pointer relative to each
+    // element, e.g. "/id") to element positions. The index follows this
+    // array: PushBack/PopBack update it in place, any other mutation marks it
+    // for a rebuild on the next lookup. Non-arrays throw JsonTypeError.
+    [[nodiscard]] Index BuildIndex(std::string_view field);
+    [[nodiscard]] Index BuildIndex(const Pointer& field);
+
+    // Sorts array elements by the value at field (a JSON Pointer relative to
+    // each element, "" for the element itself). Keys are extracted once into a
+    // flat buffer, positions are sorted (in parallel for large arrays) and the
+    // elements are then moved into place. Keys order as missing < null <
+    // booleans < numbers < NaN < strings < arrays < objects, with containers
+    // of one kind comparing equal; equal keys keep their relative order.
+    enum class SortOrder { Ascending, Descending };
+    void SortBy(std::string_view field, SortOrder order = SortOrder::Ascending);
+    void SortBy(const Pointer& field, SortOrder order = SortOrder::Ascending);
+
+    // Removes elements whose value at field equals that of an earlier element
+    // (elements missing the field count as one key). Returns the number removed.
+    size_t UniqueBy(std::string_view field);
+    size_t UniqueBy(const Pointer& field);
+
+    // Parallel algorithms over array elements. The array is split into
+    // contiguous chunks that run on an internal thread pool, with the calling
+    // thread taking part; calls made from inside a running task execute
+    // serially. fn must be safe to call concurrently on distinct elements. If
+    // a task throws, the remaining chunks are skipped and the first exception
+    // is rethrown. Non-arrays throw JsonTypeError.
+    template<typename F>
+    void ParallelForEach(F&& fn);  // fn(Json&); unshares the array once up front
+    template<typename F>
+    void ParallelForEach(F&& fn) const;  // fn(const Json&)
+    template<typename F>
+    [[nodiscard]] Json ParallelTransform(F&& fn) const;  // New array of fn(element)
+    template<typename T, typename Reduce, typename Map>
+    [[nodiscard]] T ParallelReduce(T init, Reduce reduce, Map map) const;  // reduce must be associative
+
+    // Deep comparison; handles sharing the same COW data compare equal immediately
+    [[nodiscard]] bool operator==(const Json& other) const noexcept;
+
+    // Structural hash consistent with operator== (cached for shared COW data)
+    [[nodiscard]] size_t Hash() const noexcept;
+
+    // Sampled object lookup statistics for the calling thread, off by default.
+    // Counters live in thread-local storage, so concurrent readers of a shared
+    // document never write to a cache line another thread uses.
+    struct AccessStats {
+        size_t lookups = 0;   // Sampled lookups, one in every `period`
+        size_t misses = 0;    // Sampled lookups that found no member
+        unsigned period = 0;  // 0 while sampling is off
+        [[nodiscard]] size_t EstimatedLookups() const noexcept { return lookups * period; }
+    };
+    static void SampleObjectAccess(unsigned period) noexcept;  // 1 records every lookup, 0 turns sampling off
+    [[nodiscard]] static AccessStats ThreadAccessStats() noexcept;
+    static void ResetThreadAccessStats() noexcept;
+
     // Serialization
     [[nodiscard]] std::string ToString(bool pretty = false) const;
 
+    // Direct encoding of described structs (see JsonFields) without building a DOM
+    template<JsonReflectable T>
+    [[nodiscard]] static std::string Encode(const T& value);
+    template<JsonReflectable T>
+    static void Encode(const T& value, std::string& out);  // Appends to out
+
     // Public iterator types that wrap the implementation
     class Iterator;
     class ConstIterator;
     class ObjectIterator;
     class ConstObjectIterator;
 
+    // Object members as seen through iteration. The key views the member's
+    // stored name and stays valid until that member is removed.
     struct KeyValue {
-        std::string key;  // Changed from string_view to string to avoid dangling references
+        std::string_view key;
         Json* value_ptr;  // Use pointer instead of reference to allow assignment
         
         KeyValue(std::string_view k, Json& v) : key(k), value_ptr(&v) {}
@@ -146,7 +471,7 @@ public:
     };
 
     struct ConstKeyValue {
-        std::string key;  // Changed from string_view to string to avoid dangling references
+        std::string_view key;
         const Json* value_ptr;  // Use pointer instead of reference to allow assignment
         
         ConstKeyValue(std::string_view k, const Json& v) : key(k), value_ptr(&v) {}
@@ -161,39 +486,47 @@ public:
         }
     };
 
-    // Array iteration
-    [[nodiscard]] Iterator begin() noexcept;
-    [[nodiscard]] Iterator end() noexcept;
+    // Array iteration (random access over contiguous storage; empty range for non-arrays)
+    [[nodiscard]] Iterator begin();  // Unshares a copy-on-write array before handing out mutable access
+    [[nodiscard]] Iterator end();
     [[nodiscard]] ConstIterator begin() const noexcept;
     [[nodiscard]] ConstIterator end() const noexcept;
     [[nodiscard]] ConstIterator cbegin() const noexcept;
     [[nodiscard]] ConstIterator cend() const noexcept;
 
+    // Array elements as a contiguous span (empty for non-arrays). The mutable
+    // overload unshares a copy-on-write array first.
+    [[nodiscard]] std::span<Json> Elements();
+    [[nodiscard]] std::span<const Json> Elements() const noexcept;
+
     // Object iteration
-    [[nodiscard]] ObjectIterator object_begin() noexcept;
-    [[nodiscard]] ObjectIterator object_end() noexcept;
+    [[nodiscard]] ObjectIterator object_begin();  // Unshares a copy-on-write object first
+    [[nodiscard]] ObjectIterator object_end();
     [[nodiscard]] ConstObjectIterator object_begin() const noexcept;
     [[nodiscard]] ConstObjectIterator object_end() const noexcept;
     [[nodiscard]] ConstObjectIterator object_cbegin() const noexcept;
     [[nodiscard]] ConstObjectIterator object_cend() const noexcept;
 
-    // Range helper classes
+    // Range helper classes. They refer to the Json rather than own it, so they
+    // are cheap borrowed views that compose with std::views adaptors.
     class ObjectRange {
     public:
-        explicit ObjectRange(Json& j) noexcept : json_(j) {}
-        [[nodiscard]] ObjectIterator begin() noexcept;
-        [[nodiscard]] ObjectIterator end() noexcept;
+        ObjectRange() noexcept = default;
+        explicit ObjectRange(Json& j) noexcept : json_(&j) {}
+        [[nodiscard]] ObjectIterator begin() const;
+        [[nodiscard]] ObjectIterator end() const;
     private:
-        Json& json_;
+        Json* json_ = nullptr;
     };
 
     class ConstObjectRange {
     public:
-        explicit ConstObjectRange(const Json& j) noexcept : json_(j) {}
+        ConstObjectRange() noexcept = default;
+        explicit ConstObjectRange(const Json& j) noexcept : json_(&j) {}
         [[nodiscard]] ConstObjectIterator begin() const noexcept;
         [[nodiscard]] ConstObjectIterator end() const noexcept;
     private:
-        const Json& json_;
+        const Json* json_ = nullptr;
     };
 
     [[nodiscard]] ObjectRange ObjectItems() noexcept {
@@ -205,11 +538,32 @@ public:
     }
 
 private:
+    friend class JsonWriter;
     class Impl;
     std::unique_ptr<Impl> impl_;
+
+    // Bulk conversion helpers (instantiated in Json.cpp for JsonBulkScalar types)
+    template<JsonBulkScalar T>
+    [[nodiscard]] static Json FromContiguous(const T* data, size_t count);
+    template<JsonBulkElement T>
+    [[nodiscard]] static T ConvertElement(const Json& element);
+    template<typename V>
+    [[nodiscard]] static Json FromElement(V&& value);
     
     // Validity check helpers for moved-from object access
-    void ensure_valid() const; // Implementation in Json.cpp
+    void ensure_valid() const; // Inline in JsonInline.h
+    [[noreturn]] static void ThrowInvalid();
+    [[noreturn]] static void ThrowTypeError(Type expected, Type actual);
+
+    // Parallel algorithm driver: calls body(begin, end) for each chunk of
+    // [0, count), chunk elements at a time, on the internal pool
+    [[nodiscard]] static size_t ParallelChunkSize(size_t count) noexcept;
+    static void RunParallel(size_t count, size_t chunk, const std::function<void(size_t, size_t)>& body);
+
+    // One JSON Patch operation applied in place (see ApplyPatch)
+    static void ApplyPatchOperation(Json& doc, const Json& operation);
+    static void MergePatchInto(Json& target, Json&& patch);
+    static void DiffInto(const Json& a, const Json& b, std::string& path, Json& ops);
     
     bool is_valid() const noexcept { 
         return impl_ != nullptr; 
@@ -238,127 +592,611 @@ private:
     size_t column_;
 };
 
+// Compile-time hashed key literal: obj["price"_key]
+inline namespace json_literals {
+    consteval Json::KeyView operator""_key(const char* name, size_t length) {
+        return Json::KeyView(std::string_view(name, length));
+    }
+}
+
+// JSON Pointer (RFC 6901), parsed once into unescaped, pre-hashed segments:
+//   static const Json::Pointer kCity("/address/city");
+//   const Json* city = doc.Find(kCity);
+// Segments that are valid array indices also carry the parsed index, so the
+// walk neither splits strings nor allocates. Malformed text throws JsonException.
+class Json::Pointer {
+public:
+    Pointer() = default;  // The whole document ("")
+    explicit Pointer(std::string_view text);
+
+    struct Segment {
+        std::string name;  // Unescaped reference token
+        size_t hash = 0;
+        size_t index = kNoIndex;  // Array index, or kNoIndex if the token is not one
+
+        static constexpr size_t kNoIndex = static_cast<size_t>(-1);
+        [[nodiscard]] KeyView Key() const noexcept { return KeyView(name, hash); }
+    };
+
+    [[nodiscard]] const std::string& ToString() const noexcept { return text_; }
+    [[nodiscard]] const std::vector<Segment>& Segments() const noexcept { return segments_; }
+    [[nodiscard]] size_t Size() const noexcept { return segments_.size(); }
+    [[nodiscard]] bool Empty() const noexcept { return segments_.empty(); }
+
+private:
+    std::string text_;
+    std::vector<Segment> segments_;
+};
+
+// JSONPath expression compiled once into a tree of selector and predicate
+// closures (see JsonPath.cpp), then evaluated against any number of documents:
+//   static const Json::Path kCheap("$.store.book[?(@.price < 10)].title");
+//   for (const Json* title : doc.Query(kCheap)) { ... }
+// Supports child (.name, ['name']), wildcard (*), recursive descent (..),
+// indices (negative from the end), unions ([0,2]), slices ([start:end:step])
+// and filters ([?(...)] with @ / $ paths, literals, comparisons, ! && ||).
+// Malformed expressions throw JsonException. Copies share the compiled form.
+class Json::Path {
+public:
+    explicit Path(std::string_view expression);
+
+    [[nodiscard]] const std::string& ToString() const noexcept { return text_; }
+
+    struct Program;  // Compiled form, defined in JsonPath.cpp
+
+private:
+    friend class Json;
+    std::string text_;
+    std::shared_ptr<const Program> program_;
+};
+
+// Lookup handle returned by Json::BuildIndex:
+//   Json::Index by_id = records.BuildIndex("/id");
+//   if (auto pos = by_id.Find(42)) Use(records[*pos]);
+// Elements without the field are not indexed. Candidates are compared with
+// the current field value, so a lookup never reports a stale position, but
+// it can miss one: mutable access marks the index for a rebuild when the
+// reference or iterator is handed out, so writes through one obtained before
+// BuildIndex or before an earlier lookup go unseen. Re-acquire element
+// references after building or querying the index. Move assignment keeps
+// indexes with the assigned-to variable and detaches those of the moved-from
+// one; move construction carries them along with the value. Copies of an
+// Index share one state, and lookups may rebuild it, so an index must not be
+// queried from several threads at once. Once the array is destroyed, lookups
+// throw JsonException.
+class Json::Index {
+public:
+    Index() = default;
+
+    [[nodiscard]] std::optional<size_t> Find(const Json& value) const;  // Lowest matching position
+    [[nodiscard]] std::vector<size_t> FindAll(const Json& value) const;  // Ascending positions
+    [[nodiscard]] bool Attached() const noexcept;
+    [[nodiscard]] const Pointer& Field() const;
+
+    struct State;  // Shared with the indexed array, defined in JsonImpl.h
+
+private:
+    friend class Json;
+    explicit Index(std::shared_ptr<State> state) noexcept : state_(std::move(state)) {}
+    const State& Current() const;
+
+    std::shared_ptr<State> state_;
+};
+
+// Opt-in change tracking for a root document:
+//   Json::ChangeTracker tracker(state);
+//   state["routes"][3]["weight"] = 20;
+//   state["hosts"].PushBack("b.example");
+//   Json patch = tracker.Drain();  // replace /routes/3/weight, add /hosts/2
+// Every value of the document is tagged with its place on construction, and
+// values reached later through mutable access are tagged as they are handed
+// out, so writes through references obtained at any time are recorded.
+// Assignment, Set, PushBack, PopBack, Remove and inserting operator[] append
+// one operation each to a journal, together with a COW copy of any new
+// value; SortBy and UniqueBy record moves and removals. Reserve changes no
+// value and records nothing. Drain() and Changed() cost time proportional to
+// the journal, not to the document. An operation at the same path as the
+// previous one is folded into it (a push followed by a pop leaves nothing).
+// Moving out of a tracked value copies it instead, so the document never
+// holds moved-from values. A document can have one tracker, which it must
+// outlive.
+class Json::ChangeTracker {
+public:
+    explicit ChangeTracker(const Json& root);
+    ~ChangeTracker();
+    ChangeTracker(const ChangeTracker&) = delete;
+    ChangeTracker& operator=(const ChangeTracker&) = delete;
+
+    [[nodiscard]] bool Changed() const;  // True if Drain() would return operations
+    Json Drain();  // JSON Patch since construction or the previous Drain()
+    void Reset();  // Forget pending changes
+
+    struct Node;  // Place of a tracked value, defined in JsonImpl.h
+
+private:
+    friend class Json;
+
+    enum class Op { Add, Remove, Replace, Move };
+    struct Entry {
+        Op op;
+        std::string path;
+        std::string from;  // Source path of a move
+        Json value;        // New value of an add or replace
+    };
+
+    // Hooks for Json's mutators, called only when the value is tracked
+    static void Track(Impl& parent, Json& child, const std::string& key);  // key as stored in parent
+    static void Track(Impl& parent, Json& child, size_t index);
+    static void TrackChildren(Impl& parent);
+    static void Record(Impl& target, const Json& value);  // Replaces target
+    static void Record(Impl& parent, Op op, std::string_view token, const Json* value);
+    static void RecordPermutation(Impl& parent, const std::vector<size_t>& order);
+    static void Release(Impl& impl) noexcept;
+
+    // Callers hold mutex_
+    Node* Attach(Impl& impl, Node* parent);
+    void Detach(Impl& impl) noexcept;
+    void AttachTree(Impl& impl, Node* parent);
+    bool PathOf(const Node* node, std::string& path);
+    void Append(Entry&& entry, Json& displaced);
+
+    static constexpr size_t kNodeBlock = 256;
+
+    const Json* root_;
+    Node* root_node_ = nullptr;
+    std::vector<std::unique_ptr<Node[]>> nodes_;  // Blocks of kNodeBlock
+    std::vector<Node*> free_;
+    std::vector<const Node*> chain_;  // Scratch for PathOf
+    std::vector<Entry> journal_;
+    mutable std::mutex mutex_;
+};
+
+// Atomically published document for read-mostly shared state (RCU style).
+// Readers take a snapshot, a reference-counted pointer to an immutable
+// version, without locking; writers publish a new version with one atomic
+// swap, and each old version is freed when its last snapshot is dropped:
+//   Json::AtomicRef routes(Json::Parse(text));
+//   auto snapshot = routes.Load();                  // Reader, any thread
+//   const Json& target = (*snapshot)["default"];
+//   routes.Store(Json::Parse(new_text));             // Writer
+//   routes.Update([](Json& next) { next["default"] = "b"; });
+// A reader only has to be protected while it copies the snapshot pointer, so
+// Load() registers in one of two epoch counters for those few instructions;
+// a writer swaps the version and waits for the counter of the replaced epoch
+// to drain before dropping its own reference. Writers are serialized with
+// each other. Update edits a private COW copy that unshares just the
+// containers it writes to, so published documents are only ever read.
+class Json::AtomicRef {
+public:
+    using Snapshot = std::shared_ptr<const Json>;
+
+    AtomicRef();
+    explicit AtomicRef(Json initial);
+    ~AtomicRef();
+
+    AtomicRef(const AtomicRef&) = delete;
+    AtomicRef& operator=(const AtomicRef&) = delete;
+
+    [[nodiscard]] Snapshot Load() const;
+    void Store(Json next);
+    Snapshot Exchange(Json next);  // Returns the replaced version
+
+    // Publishes desired only if expected is still current; otherwise loads
+    // the current version into expected and returns false
+    bool CompareExchange(Snapshot& expected, Json desired);
+
+    // Applies fn(Json&) to a copy of the current version and publishes it,
+    // retrying on a fresh copy if another writer got there first. Returns the
+    // version that was published.
+    template<typename F>
+    Snapshot Update(F&& fn) {
+        Snapshot expected = Load();
+        while (true) {
+            Json next = *expected;
+            fn(next);
+            if (CompareExchange(expected, std::move(next))) return expected;
+        }
+    }
+
+private:
+    Snapshot Publish(Snapshot next);  // Caller holds writer_mutex_
+
+    std::atomic<Snapshot*> current_;
+    mutable std::atomic<size_t> readers_[2] = {0, 0};  // Loads in progress, by epoch parity
+    std::atomic<unsigned> epoch_{0};
+    std::mutex writer_mutex_;
+};
+
+// Fixed set of keys with a perfect hash computed at compile time. Bind()
+// resolves every key of an object once; afterwards fields are addressed by
+// slot with no string hashing or comparison:
+//   static constexpr Json::Schema kTrade{"id"_key, "price"_key, "qty"_key};
+//   auto fields = kTrade.Bind(message);
+//   double price = fields["price"_key].Get<double>();
+template<size_t N>
+class Json::Schema {
+    static_assert(N > 0, "Schema needs at least one key");
+
+public:
+    template<typename... Keys>
+    requires (sizeof...(Keys) == N && (std::same_as<Keys, KeyView> && ...))
+    consteval Schema(Keys... keys) : keys_{keys...} {
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = i + 1; j < N; ++j) {
+                if (keys_[i].Name() == keys_[j].Name()) {
+                    throw "Json::Schema: duplicate key";
+                }
+            }
+        }
+        // Search for a multiplier that maps every key to its own bucket
+        for (uint64_t candidate = 0x9E3779B97F4A7C15ull;; candidate += 2) {
+            seed_ = candidate;
+            table_.fill(N);
+            bool collision = false;
+            for (size_t i = 0; i < N && !collision; ++i) {
+                size_t bucket = Bucket(keys_[i].HashValue());
+                collision = table_[bucket] != N;
+                table_[bucket] = i;
+            }
+            if (!collision) {
+                break;
+            }
+        }
+    }
+
+    [[nodiscard]] static constexpr size_t Size() noexcept { return N; }
+
+    // Slot of a key in this schema, or Size() if the key is not part of it
+    [[nodiscard]] constexpr size_t Slot(KeyView key) const noexcept {
+        size_t slot = table_[Bucket(key.HashValue())];
+        if (slot < N && keys_[slot].HashValue() == key.HashValue() && keys_[slot].Name() == key.Name()) {
+            return slot;
+        }
+        return N;
+    }
+
+    [[nodiscard]] constexpr KeyView KeyAt(size_t slot) const { return keys_[slot]; }
+
+    // Fields of one object resolved against the schema
+    class Fields {
+    public:
+        // nullptr when the key is missing from the object or not in the schema
+        [[nodiscard]] const Json* Find(KeyView key) const noexcept {
+            size_t slot = schema_->Slot(key);
+            return slot < N ? fields_[slot] : nullptr;
+        }
+
+        [[nodiscard]] const Json* FindSlot(size_t slot) const noexcept {
+            return slot < N ? fields_[slot] : nullptr;
+        }
+
+        [[nodiscard]] const Json& operator[](KeyView key) const {
+            const Json* field = Find(key);
+            if (!field) {
+                throw JsonException("Schema field not present: " + std::string(key.Name()));
+            }
+            return *field;
+        }
+
+        [[nodiscard]] bool Contains(KeyView key) const noexcept { return Find(key) != nullptr; }
+
+    private:
+        friend class Schema;
+        const Schema* schema_ = nullptr;
+        std::array<const Json*, N> fields_{};
+    };
+
+    // Resolves all keys of the schema in object (one probe per key, hashes precomputed)
+    [[nodiscard]] Fields Bind(const Json& object) const noexcept {
+        Fields fields;
+        fields.schema_ = this;
+        for (size_t i = 0; i < N; ++i) {
+            fields.fields_[i] = object.Find(keys_[i]);
+        }
+        return fields;
+    }
+
+private:
+    static constexpr size_t kTableSize = std::bit_ceil(N * 4);
+    static constexpr int kShift = 64 - std::countr_zero(kTableSize);
+
+    constexpr size_t Bucket(size_t hash) const noexcept {
+        return static_cast<size_t>((static_cast<uint64_t>(hash) * seed_) >> kShift);
+    }
+
+    std::array<KeyView, N> keys_;
+    std::array<size_t, kTableSize> table_{};
+    uint64_t seed_ = 0;
+};
+
+// Streaming JSON text writer. Appends compact JSON to a caller-owned buffer
+// using the same escaping and number formatting as Json::ToString().
+class JsonWriter {
+public:
+    explicit JsonWriter(std::string& out) noexcept : out_(out) {}
+
+    void Null();
+    void Bool(bool value);
+    void Number(double value);
+    void String(std::string_view value);
+    void Value(const Json& value);  // Serializes an existing DOM value
+    void Key(std::string_view key);
+    void BeginObject();
+    void EndObject();
+    void BeginArray();
+    void EndArray();
+
+    // Writes any supported C++ value: scalars, strings, Json, std::optional,
+    // described structs, maps with string keys and other ranges
+    template<typename T>
+    void Write(const T& value);
+
+    // Shared formatting primitives
+    static void AppendEscaped(std::string& out, std::string_view value);
+    static void AppendNumber(std::string& out, double value);
+
+private:
+    void Separator() {
+        if (need_comma_) out_ += ',';
+        need_comma_ = true;
+    }
+
+    std::string& out_;
+    bool need_comma_ = false;
+};
+
+template<typename T>
+void JsonWriter::Write(const T& value) {
+    if constexpr (std::same_as<T, std::nullptr_t>) {
+        Null();
+    } else if constexpr (std::same_as<T, bool>) {
+        Bool(value);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        Number(static_cast<double>(value));
+    } else if constexpr (std::convertible_to<const T&, std::string_view>) {
+        String(value);
+    } else if constexpr (std::same_as<T, Json>) {
+        Value(value);
+    } else if constexpr (requires { value.has_value(); *value; }) {
+        if (value.has_value()) {
+            Write(*value);
+        } else {
+            Null();
+        }
+    } else if constexpr (JsonReflectable<T>) {
+        BeginObject();
+        std::apply([&](const auto&... field) {
+            ((Key(field.name), Write(value.*(field.member))), ...);
+        }, JsonFields<T>::value);
+        EndObject();
+    } else if constexpr (std::ranges::input_range<const T>) {
+        using V = std::remove_cvref_t<std::ranges::range_reference_t<const T>>;
+        if constexpr (requires(const V& v) {
+                          { std::get<0>(v) } -> std::convertible_to<std::string_view>;
+                          std::get<1>(v);
+                      }) {
+            BeginObject();
+            for (const auto& entry : value) {
+                Key(std::get<0>(entry));
+                Write(std::get<1>(entry));
+            }
+            EndObject();
+        } else {
+            BeginArray();
+            for (const auto& element : value) {
+                Write(element);
+            }
+            EndArray();
+        }
+    } else {
+        static_assert(std::is_void_v<T>, "JsonWriter::Write: unsupported value type");
+    }
+}
+
+template<JsonReflectable T>
+void Json::Encode(const T& value, std::string& out) {
+    JsonWriter writer(out);
+    writer.Write(value);
+}
+
+template<JsonReflectable T>
+std::string Json::Encode(const T& value) {
+    std::string out;
+    Encode(value, out);
+    return out;
+}
+
 // Array Iterator
+// Walks the array's contiguous element storage directly. Obtaining a mutable
+// iterator unshares the array once; after that dereferencing is a plain
+// pointer access, so the standard algorithms (std::sort, std::lower_bound, ...)
+// see an ordinary contiguous range. Like std::vector iterators, these are
+// invalidated by any operation that reallocates the array.
 class Json::Iterator {
 public:
-    using iterator_category = std::bidirectional_iterator_tag;
+    using iterator_concept = std::contiguous_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
     using value_type = Json;
     using difference_type = std::ptrdiff_t;
     using pointer = Json*;
     using reference = Json&;
 
-    Iterator() noexcept;
-    Iterator& operator++();
-    Iterator operator++(int);
-    Iterator& operator--();
-    Iterator operator--(int);
-    reference operator*() const;
-    pointer operator->() const;
-    bool operator==(const Iterator& other) const noexcept;
-    bool operator!=(const Iterator& other) const noexcept;
+    Iterator() noexcept = default;
+
+    Iterator& operator++() noexcept { ++ptr_; return *this; }
+    Iterator operator++(int) noexcept { Iterator tmp(*this); ++ptr_; return tmp; }
+    Iterator& operator--() noexcept { --ptr_; return *this; }
+    Iterator operator--(int) noexcept { Iterator tmp(*this); --ptr_; return tmp; }
+    Iterator& operator+=(difference_type n) noexcept { ptr_ += n; return *this; }
+    Iterator& operator-=(difference_type n) noexcept { ptr_ -= n; return *this; }
+    [[nodiscard]] Iterator operator+(difference_type n) const noexcept { return Iterator(ptr_ + n); }
+    [[nodiscard]] Iterator operator-(difference_type n) const noexcept { return Iterator(ptr_ - n); }
+    [[nodiscard]] friend Iterator operator+(difference_type n, const Iterator& it) noexcept { return it + n; }
+    [[nodiscard]] difference_type operator-(const Iterator& other) const noexcept { return ptr_ - other.ptr_; }
+
+    [[nodiscard]] reference operator*() const noexcept { return *ptr_; }
+    [[nodiscard]] pointer operator->() const noexcept { return ptr_; }
+    [[nodiscard]] reference operator[](difference_type n) const noexcept { return ptr_[n]; }
+
+    bool operator==(const Iterator& other) const noexcept = default;
+    auto operator<=>(const Iterator& other) const noexcept = default;
 
 private:
     friend class Json;
-    explicit Iterator(Impl* impl, size_t index);
-    Impl* impl_;
-    size_t index_;
+    friend class ConstIterator;
+    explicit Iterator(Json* ptr) noexcept : ptr_(ptr) {}
+    Json* ptr_ = nullptr;
 };
 
 // Const Array Iterator
 class Json::ConstIterator {
 public:
-    using iterator_category = std::bidirectional_iterator_tag;
-    using value_type = const Json;
+    using iterator_concept = std::contiguous_iterator_tag;
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = Json;
     using difference_type = std::ptrdiff_t;
     using pointer = const Json*;
     using reference = const Json&;
 
-    ConstIterator() noexcept;
-    ConstIterator(const Iterator& it) noexcept;
-    ConstIterator& operator++();
-    ConstIterator operator++(int);
-    ConstIterator& operator--();
-    ConstIterator operator--(int);
-    reference operator*() const;
-    pointer operator->() const;
-    bool operator==(const ConstIterator& other) const noexcept;
-    bool operator!=(const ConstIterator& other) const noexcept;
+    ConstIterator() noexcept = default;
+    ConstIterator(const Iterator& it) noexcept : ptr_(it.ptr_) {}
 
-private:
-    friend class Json;
-    explicit ConstIterator(const Impl* impl, size_t index);
-    const Impl* impl_;
-    size_t index_;
-};
+    ConstIterator& operator++() noexcept { ++ptr_; return *this; }
+    ConstIterator operator++(int) noexcept { ConstIterator tmp(*this); ++ptr_; return tmp; }
+    ConstIterator& operator--() noexcept { --ptr_; return *this; }
+    ConstIterator operator--(int) noexcept { ConstIterator tmp(*this); --ptr_; return tmp; }
+    ConstIterator& operator+=(difference_type n) noexcept { ptr_ += n; return *this; }
+    ConstIterator& operator-=(difference_type n) noexcept { ptr_ -= n; return *this; }
+    [[nodiscard]] ConstIterator operator+(difference_type n) const noexcept { return ConstIterator(ptr_ + n); }
+    [[nodiscard]] ConstIterator operator-(difference_type n) const noexcept { return ConstIterator(ptr_ - n); }
+    [[nodiscard]] friend ConstIterator operator+(difference_type n, const ConstIterator& it) noexcept { return it + n; }
+    [[nodiscard]] difference_type operator-(const ConstIterator& other) const noexcept { return ptr_ - other.ptr_; }
 
-// Object Iterator
-class Json::ObjectIterator {
-public:
-    using iterator_category = std::forward_iterator_tag;  // Changed from bidirectional to forward
-    using value_type = KeyValue;
-    using difference_type = std::ptrdiff_t;
-    using pointer = KeyValue*;
-    using reference = KeyValue;
-
-    ObjectIterator() noexcept;
-    ObjectIterator(const ObjectIterator& other);  // Add copy constructor
-    ObjectIterator(ObjectIterator&& other) noexcept;  // Add move constructor
-    ObjectIterator& operator=(const ObjectIterator& other);  // Add copy assignment
-    ObjectIterator& operator=(ObjectIterator&& other) noexcept;  // Add move assignment
-    ~ObjectIterator();  // Add destructor
-    
-    ObjectIterator& operator++();
-    ObjectIterator operator++(int);
-    // Removed operator-- methods since unordered_map doesn't support bidirectional iteration
-    reference operator*();
-    KeyValue* operator->();
-    bool operator==(const ObjectIterator& other) const noexcept;
-    bool operator!=(const ObjectIterator& other) const noexcept;
+    [[nodiscard]] reference operator*() const noexcept { return *ptr_; }
+    [[nodiscard]] pointer operator->() const noexcept { return ptr_; }
+    [[nodiscard]] reference operator[](difference_type n) const noexcept { return ptr_[n]; }
+
+    bool operator==(const ConstIterator& other) const noexcept = default;
+    auto operator<=>(const ConstIterator& other) const noexcept = default;
 
 private:
     friend class Json;
-    friend class Json::ObjectRange;
-    class ObjectIterImpl;
-    std::unique_ptr<ObjectIterImpl> impl_;
-    
-    explicit ObjectIterator(Impl* json_impl);
-    ObjectIterator(Impl* json_impl, bool end);
+    explicit ConstIterator(const Json* ptr) noexcept : ptr_(ptr) {}
+    const Json* ptr_ = nullptr;
 };
 
-// Const Object Iterator
-class Json::ConstObjectIterator {
-public:
-    using iterator_category = std::forward_iterator_tag;  // Changed from bidirectional to forward
-    using value_type = ConstKeyValue;
-    using difference_type = std::ptrdiff_t;
-    using pointer = ConstKeyValue*;
-    using reference = ConstKeyValue;
-
-    ConstObjectIterator() noexcept;
-    ConstObjectIterator(const ConstObjectIterator& other);  // Add copy constructor
-    ConstObjectIterator(ConstObjectIterator&& other) noexcept;  // Add move constructor
-    ConstObjectIterator& operator=(const ConstObjectIterator& other);  // Add copy assignment
-    ConstObjectIterator& operator=(ConstObjectIterator&& other) noexcept;  // Add move assignment
-    ~ConstObjectIterator();  // Add destructor
-    
-    ConstObjectIterator(const ObjectIterator& it) noexcept;
-    ConstObjectIterator& operator++();
-    ConstObjectIterator operator++(int);
-    // Removed operator-- methods since unordered_map doesn't support bidirectional iteration
-    reference operator*();
-    ConstKeyValue* operator->();
-    bool operator==(const ConstObjectIterator& other) const noexcept;
-    bool operator!=(const ConstObjectIterator& other) const noexcept;
+// Bulk conversion templates
+template<typename V>
+Json Json::FromElement(V&& value) {
+    using T = std::remove_cvref_t<V>;
+    if constexpr (std::same_as<T, Json>) {
+        return Json(std::forward<V>(value));
+    } else if constexpr (std::same_as<T, bool>) {
+        return Json(value);
+    } else if constexpr (std::is_arithmetic_v<T>) {
+        return Json(static_cast<double>(value));
+    } else if constexpr (std::convertible_to<const T&, std::string_view>) {
+        return Json(std::string_view(value));
+    } else if constexpr (std::ranges::input_range<T>) {
+        return FromRange(std::forward<V>(value));
+    } else {
+        static_assert(std::is_void_v<T>, "FromRange: unsupported element type");
+    }
+}
 
-private:
-    friend class Json;
-    friend class Json::ConstObjectRange;
-    class ConstObjectIterImpl;
-    std::unique_ptr<ConstObjectIterImpl> impl_;
-    
-    explicit ConstObjectIterator(const Impl* json_impl);
-    ConstObjectIterator(const Impl* json_impl, bool end);
-};
+template<std::ranges::input_range R>
+Json Json::FromRange(R&& range) {
+    using V = std::remove_cvref_t<std::ranges::range_reference_t<R>>;
+
+    if constexpr (JsonBulkScalar<V> && std::ranges::contiguous_range<R> && std::ranges::sized_range<R>) {
+        // Fast path: one reservation, elements constructed in place
+        return FromContiguous(std::ranges::data(range), std::ranges::size(range));
+    } else if constexpr (requires(V v) {
+                             { std::get<0>(v) } -> std::convertible_to<std::string_view>;
+                             std::get<1>(v);
+                         }) {
+        // Key/value ranges (std::map, std::unordered_map, ...) become objects
+        Json result = Object();
+        if constexpr (std::ranges::sized_range<R>) {
+            result.Reserve(std::ranges::size(range));
+        }
+        for (auto&& entry : range) {
+            result[std::string_view(std::get<0>(entry))] = FromElement(std::get<1>(entry));
+        }
+        return result;
+    } else {
+        Json result = Array();
+        if constexpr (std::ranges::sized_range<R>) {
+            result.Reserve(std::ranges::size(range));
+        }
+        for (auto&& element : range) {
+            result.PushBack(FromElement(std::forward<decltype(element)>(element)));
+        }
+        return result;
+    }
+}
+
+// Parallel algorithm templates
+template<typename F>
+void Json::ParallelForEach(F&& fn) {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    std::span<Json> items = Elements();
+    RunParallel(items.size(), ParallelChunkSize(items.size()), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) fn(items[i]);
+    });
+}
+
+template<typename F>
+void Json::ParallelForEach(F&& fn) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    std::span<const Json> items = Elements();
+    RunParallel(items.size(), ParallelChunkSize(items.size()), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) fn(items[i]);
+    });
+}
+
+template<typename F>
+Json Json::ParallelTransform(F&& fn) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    std::span<const Json> items = Elements();
+
+    // Size the result up front so every task writes only its own slots
+    Json result = Array();
+    result.Reserve(items.size());
+    for (size_t i = 0; i < items.size(); ++i) result.PushBack(Json());
+    std::span<Json> slots = result.Elements();
+
+    RunParallel(items.size(), ParallelChunkSize(items.size()), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) slots[i] = FromElement(fn(items[i]));
+    });
+    return result;
+}
+
+template<typename T, typename Reduce, typename Map>
+T Json::ParallelReduce(T init, Reduce reduce, Map map) const {
+    if (!IsArray()) ThrowTypeError(Type::Array, GetType());
+    std::span<const Json> items = Elements();
+    if (items.empty()) return init;
+
+    // One partial per chunk, combined in chunk order so only associativity is required
+    const size_t chunk = ParallelChunkSize(items.size());
+    std::vector<std::optional<T>> partials((items.size() + chunk - 1) / chunk);
+    RunParallel(items.size(), chunk, [&](size_t begin, size_t end) {
+        T acc = map(items[begin]);
+        for (size_t i = begin + 1; i < end; ++i) acc = reduce(std::move(acc), map(items[i]));
+        partials[begin / chunk].emplace(std::move(acc));
+    });
+
+    for (auto& partial : partials) init = reduce(std::move(init), std::move(*partial));
+    return init;
+}
+
+namespace std {
+    template<>
+    struct hash<Json> {
+        size_t operator()(const Json& json) const noexcept { return json.Hash(); }
+    };
+}
 
 // Structured binding support
 namespace std {
@@ -367,7 +1205,7 @@ namespace std {
     
     template<>
     struct tuple_element<0, Json::KeyValue> {
-        using type = string;
+        using type = string_view;
     };
     
     template<>
@@ -380,7 +1218,7 @@ namespace std {
     
     template<>
     struct tuple_element<0, Json::ConstKeyValue> {
-        using type = string;
+        using type = string_view;
     };
     
     template<>
@@ -389,7 +1227,21 @@ namespace std {
     };
 }
 
-// Note: Template implementations are now in JsonTemplates.h
-// Include JsonImpl.h before JsonTemplates.h in source files that need templates
+// Borrowed views: iterators stay valid after the view object is gone, so the
+// views can be passed by value through std::views pipelines
+template<> inline constexpr bool std::ranges::enable_borrowed_range<Json::ObjectRange> = true;
+template<> inline constexpr bool std::ranges::enable_borrowed_range<Json::ConstObjectRange> = true;
+template<> inline constexpr bool std::ranges::enable_borrowed_range<Json::KeyRange> = true;
+template<> inline constexpr bool std::ranges::enable_borrowed_range<Json::ValueRange> = true;
+template<> inline constexpr bool std::ranges::enable_borrowed_range<Json::ConstValueRange> = true;
+template<> inline constexpr bool std::ranges::enable_view<Json::ObjectRange> = true;
+template<> inline constexpr bool std::ranges::enable_view<Json::ConstObjectRange> = true;
+template<> inline constexpr bool std::ranges::enable_view<Json::KeyRange> = true;
+template<> inline constexpr bool std::ranges::enable_view<Json::ValueRange> = true;
+template<> inline constexpr bool std::ranges::enable_view<Json::ConstValueRange> = true;
+
+// Inline access tier: the implementation header and the inline definitions of
+// type checks and scalar access (JsonInline.h) are part of the public header
+#include "JsonImpl.h"
 
 #endif // JSON_H
@@ -4,18 +4,14 @@
 #include <cassert>
 #include <unordered_set>
 #include <algorithm>
-
-// String interning implementation
-thread_local std::unordered_set<std::string> Json::Impl::string_pool_;
-
-const std::string& Json::Impl::InternString(const std::string& str) {
-    auto [it, inserted] = string_pool_.insert(str);
-    return *it;
-}
+#include <charconv>
+#include <bit>
+#include <utility>
 
 // OPTIMIZED Memory pool implementation with O(1) operations and larger capacity
 thread_local std::vector<std::unique_ptr<Json::Impl>> Json::Impl::object_pool_;
 thread_local size_t Json::Impl::pool_index_ = 0;
+thread_local Json::Impl::SmartObject::AccessSampler Json::Impl::SmartObject::access_sampler_;
 
 // SMART OBJECT IMPLEMENTATION - Now using inheritance-based approach
 
@@ -48,6 +44,9 @@ std::unique_ptr<Json::Impl> Json::Impl::AcquireImpl() {
 void Json::Impl::ReleaseImpl(std::unique_ptr<Impl> impl) {
     static constexpr size_t MAX_POOL_SIZE = 1000;
     
+    if (impl->indexes_) impl->DetachIndexes();
+    if (impl->track_) ChangeTracker::Release(*impl);
+    impl->data_.reset();  // Pooled objects must not keep the released value alive
     if (pool_index_ < MAX_POOL_SIZE) {
         // O(1) insertion into pool using index-based approach
         if (object_pool_.size() <= pool_index_) {
@@ -58,10 +57,6 @@ void Json::Impl::ReleaseImpl(std::unique_ptr<Impl> impl) {
     // If pool is full, let the unique_ptr destroy the object naturally
 }
 
-Json::Type Json::Impl::GetType() const noexcept {
-    return static_cast<Type>(data_->value_.index());
-}
-
 bool Json::Impl::GetBoolean() const {
     try {
         if (!std::holds_alternative<bool>(data_->value_)) {
@@ -118,6 +113,12 @@ const Json::Impl::Object& Json::Impl::GetObject() const {
 }
 
 Json::Impl::Array& Json::Impl::GetArray() {
+    auto& arr = MutableArray();
+    if (indexes_) InvalidateIndexes();  // Elements may be changed in place through the reference
+    return arr;
+}
+
+Json::Impl::Array& Json::Impl::MutableArray() {
     EnsureUnique();
     try {
         if (!std::holds_alternative<Array>(data_->value_)) {
@@ -143,26 +144,31 @@ Json::Impl::Object& Json::Impl::GetObject() {
 
 void Json::Impl::SetNull() noexcept {
     EnsureUnique();
+    if (indexes_) InvalidateIndexes();
     data_->value_ = nullptr;
 }
 
 void Json::Impl::SetBoolean(bool value) noexcept {
     EnsureUnique();
+    if (indexes_) InvalidateIndexes();
     data_->value_ = value;
 }
 
 void Json::Impl::SetNumber(Number value) noexcept {
     EnsureUnique();
+    if (indexes_) InvalidateIndexes();
     data_->value_ = value;
 }
 
 void Json::Impl::SetString(std::string value) {
     EnsureUnique();
+    if (indexes_) InvalidateIndexes();
     data_->value_ = std::move(value);
 }
 
 void Json::Impl::SetArray() {
     EnsureUnique();
+    if (indexes_) InvalidateIndexes();
     Array arr;
     arr.reserve(16);  // OPTIMIZATION: Pre-allocate reasonable capacity
     data_->value_ = std::move(arr);
@@ -170,6 +176,7 @@ void Json::Impl::SetArray() {
 
 void Json::Impl::SetObject() {
     EnsureUnique();
+    if (indexes_) InvalidateIndexes();
     Object obj;  // SmartObject automatically starts with SmallObject (vector) optimized for ≤4 keys
     data_->value_ = std::move(obj);
 }
@@ -191,7 +198,7 @@ const Json& Json::Impl::At(size_t index) const {
 }
 
 void Json::Impl::PushBack(Json value) {
-    auto& arr = GetArray();
+    auto& arr = MutableArray();
     
     // OPTIMIZATION: Smart growth prediction to reduce reallocations
     if (arr.size() == arr.capacity()) {
@@ -204,16 +211,93 @@ void Json::Impl::PushBack(Json value) {
     }
     
     arr.push_back(std::move(value));
+
+    if (indexes_) {
+        for (const auto& weak : *indexes_) {
+            auto state = weak.lock();
+            if (!state || state->stale) continue;
+            try {
+                state->Add(arr.back(), arr.size() - 1);
+            } catch (...) {
+                state->stale = true;
+            }
+        }
+    }
 }
 
 void Json::Impl::PopBack() {
-    auto& arr = GetArray();
+    auto& arr = MutableArray();
     if (arr.empty()) {
         throw JsonException("Cannot pop from empty array");
     }
+    if (indexes_) {
+        for (const auto& weak : *indexes_) {
+            if (auto state = weak.lock(); state && !state->stale) state->Remove(arr.back(), arr.size() - 1);
+        }
+    }
     arr.pop_back();
 }
 
+// Secondary indexes. States are owned by the Index handles; the array keeps
+// weak references and drops expired ones whenever it attaches a new index.
+void Json::Impl::AttachIndex(const std::shared_ptr<Index::State>& state) {
+    if (!indexes_) {
+        indexes_ = std::make_unique<std::vector<std::weak_ptr<Index::State>>>();
+    }
+    std::erase_if(*indexes_, [](const auto& weak) { return weak.expired(); });
+    state->owner = this;
+    indexes_->push_back(state);
+}
+
+void Json::Impl::AdoptIndexes(Impl& from) noexcept {
+    if (indexes_) DetachIndexes();
+    indexes_ = std::move(from.indexes_);
+    for (const auto& weak : *indexes_) {
+        if (auto state = weak.lock()) state->owner = this;
+    }
+    InvalidateIndexes();
+}
+
+void Json::Impl::InvalidateIndexes() noexcept {
+    for (const auto& weak : *indexes_) {
+        if (auto state = weak.lock()) state->stale = true;
+    }
+}
+
+void Json::Impl::DetachIndexes() noexcept {
+    for (const auto& weak : *indexes_) {
+        if (auto state = weak.lock()) {
+            state->owner = nullptr;
+            state->positions.clear();
+        }
+    }
+    indexes_.reset();
+}
+
+void Json::Index::State::Rebuild() {
+    const auto& arr = std::as_const(*owner).GetArray();
+    positions.clear();
+    positions.reserve(arr.size());
+    for (size_t i = 0; i < arr.size(); ++i) Add(arr[i], i);
+    stale = false;
+}
+
+void Json::Index::State::Add(const Json& element, size_t position) {
+    if (const Json* value = element.Find(field)) positions.emplace(value->Hash(), position);
+}
+
+void Json::Index::State::Remove(const Json& element, size_t position) {
+    const Json* value = element.Find(field);
+    if (!value) return;
+    auto [first, last] = positions.equal_range(value->Hash());
+    for (auto it = first; it != last; ++it) {
+        if (it->second == position) {
+            positions.erase(it);
+            return;
+        }
+    }
+}
+
 void Json::Impl::ReserveArray(size_t capacity) {
     GetArray().reserve(capacity);
 }
@@ -233,37 +317,79 @@ size_t Json::Impl::Size() const noexcept {
 }
 
 Json& Json::Impl::operator[](std::string_view key) {
-    auto& obj = GetObject();
-    
-    // OPTIMIZATION: Use string interning for frequently used keys
-    std::string key_str;
-    if (key.size() <= 32) {  // Only intern reasonably sized keys
-        key_str = std::string(InternString(std::string(key)));
-    } else {
-        key_str = std::string(key);
-    }
-    
-    return obj[key_str];  // SmartObject handles the access pattern optimization
+    return GetObject()[key];  // SmartObject probes with the view and copies the key only on insert
+}
+
+Json& Json::Impl::operator[](KeyView key) {
+    return GetObject()[key];
 }
 
 const Json& Json::Impl::At(std::string_view key) const {
-    const auto& obj = GetObject();
-    return obj.at(std::string(key));  // SmartObject handles the lookup
+    return GetObject().at(key);  // SmartObject handles the lookup
 }
 
-bool Json::Impl::Contains(std::string_view key) const noexcept {
+const Json& Json::Impl::At(KeyView key) const {
+    return GetObject().at(key);
+}
+
+template<typename K>
+bool Json::Impl::ContainsKey(const K& key) const noexcept {
     try {
         if (GetType() != Type::Object) return false;
-        const auto& obj = GetObject();
-        return obj.contains(std::string(key));  // SmartObject handles the lookup
+        return GetObject().contains(key);  // SmartObject handles the lookup
     } catch (const JsonException&) {
         return false; // Safe default if variant access fails
     }
 }
 
+bool Json::Impl::Contains(std::string_view key) const noexcept {
+    return ContainsKey(key);
+}
+
+bool Json::Impl::Contains(KeyView key) const noexcept {
+    return ContainsKey(key);
+}
+
+template<typename K>
+const Json* Json::Impl::FindKey(const K& key) const noexcept {
+    const auto* obj = std::get_if<Object>(&data_->value_);
+    if (!obj) {
+        return nullptr;
+    }
+    auto it = obj->find(key);
+    return it != obj->end() ? &it->second : nullptr;
+}
+
+const Json* Json::Impl::Find(std::string_view key) const noexcept {
+    return FindKey(key);
+}
+
+const Json* Json::Impl::Find(KeyView key) const noexcept {
+    return FindKey(key);
+}
+
+template<typename K>
+Json* Json::Impl::FindMutableKey(const K& key) {
+    // Look up read-only first so a miss unshares nothing
+    if (!FindKey(key)) return nullptr;
+    auto& obj = GetObject();  // Unshares before handing out a mutable pointer
+    return &obj.find(key)->second;
+}
+
+Json* Json::Impl::Find(std::string_view key) {
+    return FindMutableKey(key);
+}
+
+Json* Json::Impl::Find(KeyView key) {
+    return FindMutableKey(key);
+}
+
 void Json::Impl::Remove(std::string_view key) {
-    auto& obj = GetObject();
-    obj.erase(std::string(key));  // SmartObject handles the removal
+    GetObject().erase_key(key);  // SmartObject handles the removal
+}
+
+void Json::Impl::Remove(KeyView key) {
+    GetObject().erase_key(key);
 }
 
 void Json::Impl::ReserveObject(size_t capacity) {
@@ -282,13 +408,193 @@ std::vector<std::string> Json::Impl::Keys() const {
     return keys;
 }
 
-std::string Json::Impl::ToString(bool pretty) const {
-    std::ostringstream ss;
+// Numeric aggregation. Elements are boxed Json values, so numbers are first
+// gathered into a small contiguous block and the arithmetic then runs over
+// plain doubles with independent accumulators.
+namespace {
+
+constexpr size_t kGatherBlock = 256;
+
+template<typename Flush>
+void GatherNumbers(const std::vector<Json>& arr, const Json::Pointer* field, Flush&& flush) {
+    double block[kGatherBlock];
+    size_t filled = 0;
+    for (const Json& element : arr) {
+        const Json* value = field ? element.Find(*field) : &element;
+        const double* number = value ? value->GetIf<double>() : nullptr;
+        if (!number) continue;
+        block[filled++] = *number;
+        if (filled == kGatherBlock) {
+            flush(block, filled);
+            filled = 0;
+        }
+    }
+    if (filled) flush(block, filled);
+}
+
+} // namespace
+
+Json::Impl::NumericSummary Json::Impl::Summarize(const Pointer* field) const {
+    NumericSummary summary;
+    double sums[4] = {0, 0, 0, 0};
+    GatherNumbers(GetArray(), field, [&](const double* block, size_t n) {
+        const size_t quads = n - n % 4;
+        size_t i = 0;
+        for (; i < quads; i += 4) {
+            sums[0] += block[i];
+            sums[1] += block[i + 1];
+            sums[2] += block[i + 2];
+            sums[3] += block[i + 3];
+        }
+        for (; i < n; ++i) sums[0] += block[i];
+
+        double lo = summary.min, hi = summary.max;
+        for (i = 0; i < n; ++i) {
+            lo = std::min(lo, block[i]);
+            hi = std::max(hi, block[i]);
+        }
+        summary.min = lo;
+        summary.max = hi;
+        summary.count += n;
+    });
+    summary.sum = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+    return summary;
+}
+
+void Json::Impl::ExtractColumn(const Pointer& field, std::vector<double>& out) const {
+    const auto& arr = GetArray();
+    out.clear();
+    out.reserve(arr.size());
+    for (const Json& element : arr) {
+        const Json* value = element.Find(field);
+        if (!value) {
+            throw JsonException("ExtractColumn: element has no value at '" + field.ToString() + "'");
+        }
+        const double* number = value->GetIf<double>();
+        if (!number) Json::ThrowTypeError(Type::Number, value->GetType());
+        out.push_back(*number);
+    }
+}
+
+bool Json::Impl::Equals(const Impl& other) const noexcept {
+    if (data_ == other.data_) {
+        return true;  // Same COW block: identical without looking inside
+    }
+    // Cached hashes are not consulted: a child written through a reference
+    // held across a copy leaves its ancestors' cached hashes stale
     
+    const auto& lhs = data_->value_;
+    const auto& rhs = other.data_->value_;
+    if (lhs.index() != rhs.index()) {
+        return false;
+    }
+    
+    switch (GetType()) {
+        case Type::Null:
+            return true;
+        case Type::Boolean:
+            return std::get<bool>(lhs) == std::get<bool>(rhs);
+        case Type::Number:
+            return std::get<Number>(lhs) == std::get<Number>(rhs);
+        case Type::String:
+            return std::get<std::string>(lhs) == std::get<std::string>(rhs);
+        case Type::Array: {
+            const auto& a = std::get<Array>(lhs);
+            const auto& b = std::get<Array>(rhs);
+            if (a.size() != b.size()) return false;
+            for (size_t i = 0; i < a.size(); ++i) {
+                if (!(a[i] == b[i])) return false;
+            }
+            return true;
+        }
+        case Type::Object: {
+            const auto& a = std::get<Object>(lhs);
+            const auto& b = std::get<Object>(rhs);
+            if (a.size() != b.size()) return false;
+            for (const auto& [key, value] : a) {
+                auto it = b.find(key);
+                if (it == b.end() || !(value == it->second)) return false;
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+namespace {
+    // 64-bit finalizer (MurmurHash3 fmix64)
+    constexpr uint64_t MixHash(uint64_t h) noexcept {
+        h ^= h >> 33;
+        h *= 0xFF51AFD7ED558CCDull;
+        h ^= h >> 33;
+        h *= 0xC4CEB9FE1A85EC53ull;
+        h ^= h >> 33;
+        return h;
+    }
+}
+
+size_t Json::Impl::StructuralHash() const noexcept {
+    // Shared blocks cannot change under COW, so their hash is cached; unique
+    // blocks may still be edited through outstanding references and are
+    // recomputed (their shared children still hit the cache). A reference held
+    // across a copy can still write below a cached block, so the cache is a
+    // hint for lookups and never decides equality
+    bool shared = data_.use_count() > 1;
+    if (shared) {
+        size_t cached = data_->hash_.load(std::memory_order_relaxed);
+        if (cached != 0) return cached;
+    }
+    
+    uint64_t h = static_cast<uint64_t>(data_->value_.index()) * 0x9E3779B97F4A7C15ull;
+    switch (GetType()) {
+        case Type::Null:
+            break;
+        case Type::Boolean:
+            h ^= std::get<bool>(data_->value_) ? 1 : 2;
+            break;
+        case Type::Number: {
+            Number n = std::get<Number>(data_->value_);
+            if (n == 0) n = 0;  // -0.0 == 0.0, so they must hash alike
+            h ^= std::bit_cast<uint64_t>(n);
+            break;
+        }
+        case Type::String:
+            h ^= KeyView::Hash(std::get<std::string>(data_->value_));
+            break;
+        case Type::Array:
+            for (const Json& element : std::get<Array>(data_->value_)) {
+                h = MixHash(h + element.Hash());
+            }
+            break;
+        case Type::Object: {
+            // Members are unordered, so combine them commutatively
+            uint64_t members = 0;
+            for (const auto& [key, value] : std::get<Object>(data_->value_)) {
+                members += MixHash(KeyView::Hash(key) ^ (static_cast<uint64_t>(value.Hash()) * 0x9E3779B97F4A7C15ull));
+            }
+            h ^= members + std::get<Object>(data_->value_).size();
+            break;
+        }
+    }
+    size_t result = static_cast<size_t>(MixHash(h));
+    if (result == 0) result = 1;  // 0 marks "not computed"
+    if (shared) {
+        data_->hash_.store(result, std::memory_order_relaxed);
+    }
+    return result;
+}
+
+std::string Json::Impl::ToString(bool pretty) const {
+    std::string out;
+    AppendTo(out, pretty);
+    return out;
+}
+
+void Json::Impl::AppendTo(std::string& out, bool pretty) const {
     class Printer {
     public:
-        explicit Printer(std::ostringstream& ss, bool pretty) 
-            : ss_(ss), pretty_(pretty), indent_(0) {}
+        explicit Printer(std::string& out, bool pretty) 
+            : out_(out), pretty_(pretty), indent_(0) {}
         
         using Value = std::variant<std::nullptr_t, bool, Number, std::string, Array, Object>;
         
@@ -316,53 +622,34 @@ std::string Json::Impl::ToString(bool pretty) const {
     private:
         void PrintIndent() {
             if (pretty_) {
-                ss_ << std::string(indent_ * 2, ' ');
+                out_.append(indent_ * 2, ' ');
             }
         }
         
         void PrintNewline() {
             if (pretty_) {
-                ss_ << '\n';
+                out_ += '\n';
             }
         }
         
         void PrintValue(std::nullptr_t) {
-            ss_ << "null";
+            out_ += "null";
         }
         
         void PrintValue(bool value) {
-            ss_ << (value ? "true" : "false");
+            out_ += value ? "true" : "false";
         }
         
         void PrintValue(Number value) {
-            ss_ << std::setprecision(17) << value;
+            JsonWriter::AppendNumber(out_, value);
         }
         
         void PrintValue(const std::string& value) {
-            ss_ << '"';
-            for (char c : value) {
-                switch (c) {
-                    case '"': ss_ << "\\\""; break;
-                    case '\\': ss_ << "\\\\"; break;
-                    case '\b': ss_ << "\\b"; break;
-                    case '\f': ss_ << "\\f"; break;
-                    case '\n': ss_ << "\\n"; break;
-                    case '\r': ss_ << "\\r"; break;
-                    case '\t': ss_ << "\\t"; break;
-                    default:
-                        if (static_cast<unsigned char>(c) < 0x20) {
-                            ss_ << "\\u" << std::hex << std::setw(4) 
-                                << std::setfill('0') << static_cast<int>(c);
-                        } else {
-                            ss_ << c;
-                        }
-                }
-            }
-            ss_ << '"';
+            JsonWriter::AppendEscaped(out_, value);
         }
         
         void PrintValue(const Array& arr) {
-            ss_ << '[';
+            out_ += '[';
             if (!arr.empty()) {
                 PrintNewline();
                 ++indent_;
@@ -370,18 +657,18 @@ std::string Json::Impl::ToString(bool pretty) const {
                     PrintIndent();
                     PrintWithCircularCheck(arr[i].impl_.get());
                     if (i < arr.size() - 1) {
-                        ss_ << ',';
+                        out_ += ',';
                     }
                     PrintNewline();
                 }
                 --indent_;
                 PrintIndent();
             }
-            ss_ << ']';
+            out_ += ']';
         }
         
         void PrintValue(const Object& obj) {
-            ss_ << '{';
+            out_ += '{';
             if (!obj.empty()) {
                 PrintNewline();
                 ++indent_;
@@ -389,10 +676,10 @@ std::string Json::Impl::ToString(bool pretty) const {
                 for (const auto& [key, value] : obj) {
                     PrintIndent();
                     PrintValue(key);
-                    ss_ << (pretty_ ? ": " : ":");
+                    out_ += pretty_ ? ": " : ":";
                     PrintWithCircularCheck(value.impl_.get());
                     if (i < obj.size() - 1) {
-                        ss_ << ',';
+                        out_ += ',';
                     }
                     PrintNewline();
                     ++i;
@@ -400,16 +687,107 @@ std::string Json::Impl::ToString(bool pretty) const {
                 --indent_;
                 PrintIndent();
             }
-            ss_ << '}';
+            out_ += '}';
         }
         
-        std::ostringstream& ss_;
+        std::string& out_;
         bool pretty_;
         size_t indent_;
         std::unordered_set<const Impl*> visiting_;
     };
     
-    Printer printer(ss, pretty);
+    Printer printer(out, pretty);
     printer.PrintWithCircularCheck(this);
-    return ss.str();
+}
+
+// JsonWriter implementation
+void JsonWriter::AppendEscaped(std::string& out, std::string_view value) {
+    static constexpr char kHex[] = "0123456789abcdef";
+    out += '"';
+    size_t run_start = 0;
+    for (size_t i = 0; i < value.size(); ++i) {
+        unsigned char c = static_cast<unsigned char>(value[i]);
+        if (c >= 0x20 && c != '"' && c != '\\') {
+            continue;  // Plain characters are copied in runs below
+        }
+        out.append(value.data() + run_start, i - run_start);
+        run_start = i + 1;
+        switch (c) {
+            case '"': out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\b': out += "\\b"; break;
+            case '\f': out += "\\f"; break;
+            case '\n': out += "\\n"; break;
+            case '\r': out += "\\r"; break;
+            case '\t': out += "\\t"; break;
+            default: {
+                const char escape[] = {'\\', 'u', '0', '0', kHex[c >> 4], kHex[c & 0xF]};
+                out.append(escape, sizeof(escape));
+            }
+        }
+    }
+    out.append(value.data() + run_start, value.size() - run_start);
+    out += '"';
+}
+
+void JsonWriter::AppendNumber(std::string& out, double value) {
+    // Same output as ostream << std::setprecision(17), without the stream
+    char buffer[32];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::general, 17);
+    out.append(buffer, end);
+}
+
+void JsonWriter::Null() {
+    Separator();
+    out_ += "null";
+}
+
+void JsonWriter::Bool(bool value) {
+    Separator();
+    out_ += value ? "true" : "false";
+}
+
+void JsonWriter::Number(double value) {
+    Separator();
+    AppendNumber(out_, value);
+}
+
+void JsonWriter::String(std::string_view value) {
+    Separator();
+    AppendEscaped(out_, value);
+}
+
+void JsonWriter::Value(const Json& value) {
+    value.ensure_valid();
+    Separator();
+    value.impl_->AppendTo(out_, false);
+}
+
+void JsonWriter::Key(std::string_view key) {
+    Separator();
+    AppendEscaped(out_, key);
+    out_ += ':';
+    need_comma_ = false;  // The value that follows belongs to this key
+}
+
+void JsonWriter::BeginObject() {
+    Separator();
+    out_ += '{';
+    need_comma_ = false;
+}
+
+void JsonWriter::EndObject() {
+    out_ += '}';
+    need_comma_ = true;
+}
+
+void JsonWriter::BeginArray() {
+    Separator();
+    out_ += '[';
+    need_comma_ = false;
+}
+
+void JsonWriter::EndArray() {
+    out_ += ']';
+    need_comma_ = true;
 }
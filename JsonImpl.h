@@ -9,16 +9,37 @@
 #include <memory>
 #include <unordered_set>
 #include <atomic>
+#include <stdexcept>
+#include <limits>
 
 class Json::Impl {
 public:
     using Number = double;
     using Array = std::vector<Json>;
     
+    // Transparent hashing: std::string, std::string_view and Json::Key all probe
+    // the same buckets, so lookups never construct a temporary std::string
+    struct KeyHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view key) const noexcept { return KeyView::Hash(key); }
+        size_t operator()(const std::string& key) const noexcept { return KeyView::Hash(key); }
+        size_t operator()(KeyView key) const noexcept { return key.HashValue(); }
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+        bool operator()(std::string_view lhs, std::string_view rhs) const noexcept { return lhs == rhs; }
+        bool operator()(KeyView lhs, std::string_view rhs) const noexcept { return lhs.Name() == rhs; }
+        bool operator()(std::string_view lhs, KeyView rhs) const noexcept { return lhs == rhs.Name(); }
+    };
+
+    static std::string_view KeyText(std::string_view key) noexcept { return key; }
+    static std::string_view KeyText(KeyView key) noexcept { return key.Name(); }
+
     // SMART CONTAINER SELECTION: Optimized unordered_map with intelligent sizing
-    class SmartObject : public std::unordered_map<std::string, Json> {
+    class SmartObject : public std::unordered_map<std::string, Json, KeyHash, KeyEqual> {
     private:
-        mutable size_t access_count_ = 0;
+        using Base = std::unordered_map<std::string, Json, KeyHash, KeyEqual>;
         static constexpr size_t SMALL_OBJECT_THRESHOLD = 8;
         static constexpr size_t MEDIUM_OBJECT_THRESHOLD = 32;
         
@@ -28,40 +49,63 @@ public:
             reserve(SMALL_OBJECT_THRESHOLD);
         }
         
-                 // Override operator[] to add smart growth
-         Json& operator[](const std::string& key) {
-             access_count_++;
-             
-             // Smart capacity management based on usage patterns
-             // Check if we need to reserve more space based on load factor
-             if (load_factor() > 0.75) {  // Load factor approaching limit
-                 size_t new_bucket_count;
-                 if (size() < SMALL_OBJECT_THRESHOLD) {
-                     new_bucket_count = SMALL_OBJECT_THRESHOLD;
-                 } else if (size() < MEDIUM_OBJECT_THRESHOLD) {
-                     new_bucket_count = MEDIUM_OBJECT_THRESHOLD;
-                 } else {
-                     new_bucket_count = bucket_count() * 2;  // Exponential growth for large objects
-                 }
-                 
-                 if (new_bucket_count > bucket_count()) {
-                     reserve(new_bucket_count);
-                 }
-             }
-             
-             return std::unordered_map<std::string, Json>::operator[](key);
-         }
+        // Override operator[] to add smart growth; the key is only copied on insertion
+        template<typename K>
+        Json& operator[](const K& key) {
+            auto it = find(key);
+            record_lookup(it != end());
+            if (it != end()) {
+                return it->second;
+            }
+            
+            // Smart capacity management based on usage patterns
+            // Check if we need to reserve more space based on load factor
+            if (load_factor() > 0.75) {  // Load factor approaching limit
+                size_t new_bucket_count;
+                if (size() < SMALL_OBJECT_THRESHOLD) {
+                    new_bucket_count = SMALL_OBJECT_THRESHOLD;
+                } else if (size() < MEDIUM_OBJECT_THRESHOLD) {
+                    new_bucket_count = MEDIUM_OBJECT_THRESHOLD;
+                } else {
+                    new_bucket_count = bucket_count() * 2;  // Exponential growth for large objects
+                }
+                
+                if (new_bucket_count > bucket_count()) {
+                    reserve(new_bucket_count);
+                }
+            }
+            
+            return Base::try_emplace(std::string(KeyText(key))).first->second;
+        }
         
-        // Override at() to track access patterns
-        const Json& at(const std::string& key) const {
-            access_count_++;
-            return std::unordered_map<std::string, Json>::at(key);
+        // Lookups are only recorded in the calling thread's sampler, so const
+        // access to a shared object never writes to shared memory
+        template<typename K>
+        const Json& at(const K& key) const {
+            auto it = find(key);
+            record_lookup(it != end());
+            if (it == end()) {
+                throw std::out_of_range("SmartObject::at: key not found");
+            }
+            return it->second;
         }
         
-        // Override contains to track access patterns  
-        bool contains(const std::string& key) const {
-            access_count_++;
-            return std::unordered_map<std::string, Json>::contains(key);
+        template<typename K>
+        bool contains(const K& key) const {
+            const bool found = Base::contains(key);
+            record_lookup(found);
+            return found;
+        }
+        
+        // Heterogeneous erase (std::unordered_map only gains this in C++23)
+        template<typename K>
+        size_t erase_key(const K& key) {
+            auto it = find(key);
+            if (it == end()) {
+                return 0;
+            }
+            erase(it);
+            return 1;
         }
         
         // Smart reserve that considers object size patterns
@@ -76,9 +120,24 @@ public:
             }
         }
         
-        // Access pattern analysis
-        size_t get_access_count() const { return access_count_; }
-        void reset_access_count() { access_count_ = 0; }
+        // Per-thread access sampling (see Json::SampleObjectAccess)
+        struct AccessSampler {
+            AccessStats stats;
+            unsigned countdown = 0;
+        };
+        static thread_local AccessSampler access_sampler_;
+
+        static void record_lookup(bool found) noexcept {
+            AccessSampler& sampler = access_sampler_;
+            if (sampler.stats.period == 0 || --sampler.countdown != 0) {
+                return;
+            }
+            sampler.countdown = sampler.stats.period;
+            ++sampler.stats.lookups;
+            if (!found) {
+                ++sampler.stats.misses;
+            }
+        }
     };
     
     using Object = SmartObject;  // Use smart object selection
@@ -86,6 +145,11 @@ public:
     // Copy-on-Write data structure
     struct COW_Data {
         std::variant<std::nullptr_t, bool, Number, std::string, Array, Object> value_;
+        // Cached structural hash (0 = not computed). Only filled while the data is
+        // shared, i.e. immutable under COW; cleared whenever it is about to change.
+        // Writes through references held across a copy bypass that, so equality
+        // never rejects on it.
+        mutable std::atomic<size_t> hash_{0};
         
         COW_Data() : value_(nullptr) {}
         COW_Data(std::variant<std::nullptr_t, bool, Number, std::string, Array, Object>&& val) 
@@ -101,6 +165,12 @@ public:
     // COW implementation
     mutable std::shared_ptr<COW_Data> data_;
 
+    // Indexes following this array (Json::BuildIndex); null when there are none
+    std::unique_ptr<std::vector<std::weak_ptr<Index::State>>> indexes_;
+
+    // Place in a document under a Json::ChangeTracker; null when untracked
+    ChangeTracker::Node* track_ = nullptr;
+
     void EnsureUnique() const {
         if (data_ && data_.use_count() > 1) {
             // Create a deep copy
@@ -108,12 +178,9 @@ public:
             new_data->value_ = data_->value_;  // This will deep copy the variant
             data_ = std::move(new_data);
         }
+        data_->hash_.store(0, std::memory_order_relaxed);  // Caller is about to mutate
     }
 
-    // String interning for frequently used keys
-    static thread_local std::unordered_set<std::string> string_pool_;
-    static const std::string& InternString(const std::string& str);
-
     // OPTIMIZED Memory pool for Json::Impl objects with O(1) operations
     static thread_local std::vector<std::unique_ptr<Impl>> object_pool_;
     static thread_local size_t pool_index_;
@@ -130,6 +197,7 @@ public:
     Impl& operator=(const Impl& other) {
         if (this != &other) {
             data_ = other.data_;  // Shallow copy for COW
+            if (indexes_) InvalidateIndexes();
         }
         return *this;
     }
@@ -137,14 +205,20 @@ public:
     Impl& operator=(Impl&& other) noexcept {
         if (this != &other) {
             data_ = std::move(other.data_);
+            if (indexes_) InvalidateIndexes();
         }
         return *this;
     }
     
-    ~Impl() = default;
+    ~Impl() {
+        if (indexes_) DetachIndexes();
+        if (track_) ChangeTracker::Release(*this);
+    }
 
     // Value access
-    [[nodiscard]] Type GetType() const noexcept;
+    [[nodiscard]] Type GetType() const noexcept {
+        return static_cast<Type>(data_->value_.index());
+    }
     [[nodiscard]] bool GetBoolean() const;
     [[nodiscard]] Number GetNumber() const;
     [[nodiscard]] const std::string& GetString() const;
@@ -169,18 +243,57 @@ public:
     void ReserveArray(size_t capacity);
     [[nodiscard]] size_t Size() const noexcept;
 
+    // Secondary index bookkeeping
+    void AttachIndex(const std::shared_ptr<Index::State>& state);
+    void AdoptIndexes(Impl& from) noexcept;  // Takes over from's indexes, e.g. on move assignment
+    void InvalidateIndexes() noexcept;
+    void DetachIndexes() noexcept;
+
     // Object operations
     Json& operator[](std::string_view key);
     const Json& At(std::string_view key) const;
     [[nodiscard]] bool Contains(std::string_view key) const noexcept;
     void Remove(std::string_view key);
+    Json& operator[](KeyView key);
+    const Json& At(KeyView key) const;
+    [[nodiscard]] bool Contains(KeyView key) const noexcept;
+    void Remove(KeyView key);
+    [[nodiscard]] const Json* Find(std::string_view key) const noexcept;
+    [[nodiscard]] const Json* Find(KeyView key) const noexcept;
+    [[nodiscard]] Json* Find(std::string_view key);
+    [[nodiscard]] Json* Find(KeyView key);
     void ReserveObject(size_t capacity);
     [[nodiscard]] std::vector<std::string> Keys() const;
 
+    // Numeric aggregation over array elements, or over the value at field in
+    // each element when field is non-null. Non-numbers are skipped.
+    struct NumericSummary {
+        size_t count = 0;
+        double sum = 0;
+        double min = std::numeric_limits<double>::infinity();
+        double max = -std::numeric_limits<double>::infinity();
+    };
+    [[nodiscard]] NumericSummary Summarize(const Pointer* field) const;
+    void ExtractColumn(const Pointer& field, std::vector<double>& out) const;  // Throws on missing or non-numeric values
+
+    // Comparison and hashing
+    [[nodiscard]] bool Equals(const Impl& other) const noexcept;
+    [[nodiscard]] size_t StructuralHash() const noexcept;
+
     // Serialization
     [[nodiscard]] std::string ToString(bool pretty) const;
+    void AppendTo(std::string& out, bool pretty) const;
 
 private:
+    Array& MutableArray();  // GetArray() without invalidating indexes
+
+    template<typename K>
+    [[nodiscard]] bool ContainsKey(const K& key) const noexcept;
+    template<typename K>
+    [[nodiscard]] const Json* FindKey(const K& key) const noexcept;
+    template<typename K>
+    [[nodiscard]] Json* FindMutableKey(const K& key);
+
     template<typename T>
     [[nodiscard]] const T& Get() const {
         return std::get<T>(data_->value_);
@@ -192,4 +305,32 @@ private:
     }
 };
 
+// Shared between a Json::Index handle and the array it follows
+struct Json::Index::State {
+    explicit State(Pointer field_pointer) : field(std::move(field_pointer)) {}
+
+    Pointer field;
+    Impl* owner = nullptr;  // Indexed array; null once it is gone
+    std::unordered_multimap<size_t, size_t> positions;  // Field value hash -> element position
+    bool stale = true;
+
+    void Rebuild();
+    void Add(const Json& element, size_t position);
+    void Remove(const Json& element, size_t position);
+};
+
+// Owned by the tracker; the value points back through Impl::track_. A node
+// only records where the value was put, and every use re-checks that the
+// value still sits there in its parent's current storage. key points at the
+// name stored with the member, which lives as long as the member does.
+struct Json::ChangeTracker::Node {
+    ChangeTracker* tracker = nullptr;
+    Node* parent = nullptr;  // Null for the root
+    Impl* impl = nullptr;    // Null once the value is gone and the node is free
+    const std::string* key = nullptr;  // Member name in the parent's storage; null for elements
+    size_t index = 0;                  // Position, when the parent is an array
+};
+
+#include "JsonInline.h"
+
 #endif // JSON_IMPL_H
@@ -0,0 +1,283 @@
+#ifndef JSON_INLINE_H
+#define JSON_INLINE_H
+
+// Header-inline access tier. Type checks, scalar reads and object iteration
+// are defined here so they compile down to a few loads and compares at the
+// call site instead of an out-of-line call through the pimpl. Included at the
+// end of JsonImpl.h; do not include directly.
+
+#include "JsonImpl.h"
+
+// Validity check helpers for moved-from object access
+inline void Json::ensure_valid() const {
+    if (!impl_) [[unlikely]] {
+        ThrowInvalid();
+    }
+}
+
+// Type checking
+inline bool Json::IsNull() const noexcept {
+    return impl_ && impl_->data_->value_.index() == static_cast<size_t>(Type::Null);
+}
+
+inline bool Json::IsBoolean() const noexcept {
+    return impl_ && impl_->data_->value_.index() == static_cast<size_t>(Type::Boolean);
+}
+
+inline bool Json::IsNumber() const noexcept {
+    return impl_ && impl_->data_->value_.index() == static_cast<size_t>(Type::Number);
+}
+
+inline bool Json::IsString() const noexcept {
+    return impl_ && impl_->data_->value_.index() == static_cast<size_t>(Type::String);
+}
+
+inline bool Json::IsArray() const noexcept {
+    return impl_ && impl_->data_->value_.index() == static_cast<size_t>(Type::Array);
+}
+
+inline bool Json::IsObject() const noexcept {
+    return impl_ && impl_->data_->value_.index() == static_cast<size_t>(Type::Object);
+}
+
+inline Json::Type Json::GetType() const noexcept {
+    if (!impl_) return Type::Null; // Safe default for moved-from objects
+    return impl_->GetType();
+}
+
+// Scalar access
+template<typename T>
+requires std::same_as<T, bool> ||
+         std::integral<T> ||
+         std::floating_point<T> ||
+         std::convertible_to<T, std::string_view>
+T Json::Get() const {
+    ensure_valid();
+    const auto& value = impl_->data_->value_;
+    if constexpr (std::same_as<T, bool>) {
+        if (const bool* b = std::get_if<bool>(&value)) [[likely]] return *b;
+        ThrowTypeError(Type::Boolean, GetType());
+    }
+    else if constexpr (std::integral<T> || std::floating_point<T>) {
+        if (const Impl::Number* n = std::get_if<Impl::Number>(&value)) [[likely]] return static_cast<T>(*n);
+        ThrowTypeError(Type::Number, GetType());
+    }
+    else if constexpr (std::convertible_to<T, std::string_view>) {
+        if (const std::string* str = std::get_if<std::string>(&value)) [[likely]] return T(*str);
+        ThrowTypeError(Type::String, GetType());
+    }
+}
+
+template<typename T>
+std::optional<T> Json::TryGet() const noexcept {
+    // Checks the variant directly so a mismatch costs no exception
+    if (!impl_) return std::nullopt; // Safe default for moved-from objects
+    const auto& value = impl_->data_->value_;
+    if constexpr (std::same_as<T, bool>) {
+        if (const bool* b = std::get_if<bool>(&value)) return *b;
+    }
+    else if constexpr (std::integral<T> || std::floating_point<T>) {
+        if (const Impl::Number* n = std::get_if<Impl::Number>(&value)) return static_cast<T>(*n);
+    }
+    else if constexpr (std::convertible_to<T, std::string_view>) {
+        if (const std::string* str = std::get_if<std::string>(&value)) return T(*str);
+    }
+    return std::nullopt;
+}
+
+template<typename T>
+requires std::same_as<T, bool> ||
+         std::same_as<T, double> ||
+         std::same_as<T, std::string>
+const T* Json::GetIf() const noexcept {
+    if (!impl_) return nullptr; // Safe default for moved-from objects
+    return std::get_if<T>(&impl_->data_->value_);
+}
+
+// Array access
+inline Json& Json::operator[](size_t index) {
+    ensure_valid();
+    Json& element = impl_->At(index);
+    if (impl_->track_) [[unlikely]] ChangeTracker::Track(*impl_, element, index);
+    return element;
+}
+
+inline const Json& Json::operator[](size_t index) const {
+    ensure_valid();
+    const auto* arr = std::get_if<Impl::Array>(&impl_->data_->value_);
+    if (!arr || index >= arr->size()) [[unlikely]] {
+        return impl_->At(index);  // Throws the appropriate JsonException
+    }
+    return (*arr)[index];
+}
+
+inline size_t Json::Size() const {
+    ensure_valid();
+    const auto& value = impl_->data_->value_;
+    if (const auto* arr = std::get_if<Impl::Array>(&value)) return arr->size();
+    if (const auto* obj = std::get_if<Impl::Object>(&value)) return obj->size();
+    throw JsonException("Size() can only be called on arrays or objects");
+}
+
+// Object iteration. The iterators are defined here rather than in Json.h
+// because they hold the object's map iterator directly, which needs the
+// complete SmartObject type. They are trivially copyable and never allocate;
+// dereferencing yields a KeyValue handle built on the fly.
+class Json::ObjectIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = KeyValue;
+    using difference_type = std::ptrdiff_t;
+    using reference = KeyValue;
+
+    // operator-> needs an addressable KeyValue; this proxy carries it
+    struct pointer {
+        KeyValue item;
+        KeyValue* operator->() noexcept { return &item; }
+    };
+
+    ObjectIterator() noexcept = default;
+
+    ObjectIterator& operator++() noexcept { ++it_; return *this; }
+    ObjectIterator operator++(int) noexcept { ObjectIterator tmp(*this); ++it_; return tmp; }
+    [[nodiscard]] reference operator*() const noexcept { return KeyValue(it_->first, it_->second); }
+    [[nodiscard]] pointer operator->() const noexcept { return pointer{**this}; }
+    bool operator==(const ObjectIterator& other) const noexcept { return it_ == other.it_; }
+
+private:
+    friend class Json;
+    friend class Json::ConstObjectIterator;
+    explicit ObjectIterator(Impl::Object::iterator it) noexcept : it_(it) {}
+    Impl::Object::iterator it_{};
+};
+
+class Json::ConstObjectIterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = ConstKeyValue;
+    using difference_type = std::ptrdiff_t;
+    using reference = ConstKeyValue;
+
+    struct pointer {
+        ConstKeyValue item;
+        const ConstKeyValue* operator->() const noexcept { return &item; }
+    };
+
+    ConstObjectIterator() noexcept = default;
+    ConstObjectIterator(const ObjectIterator& it) noexcept : it_(it.it_) {}
+
+    ConstObjectIterator& operator++() noexcept { ++it_; return *this; }
+    ConstObjectIterator operator++(int) noexcept { ConstObjectIterator tmp(*this); ++it_; return tmp; }
+    [[nodiscard]] reference operator*() const noexcept { return ConstKeyValue(it_->first, it_->second); }
+    [[nodiscard]] pointer operator->() const noexcept { return pointer{**this}; }
+    bool operator==(const ConstObjectIterator& other) const noexcept { return it_ == other.it_; }
+
+private:
+    friend class Json;
+    explicit ConstObjectIterator(Impl::Object::const_iterator it) noexcept : it_(it) {}
+    Impl::Object::const_iterator it_{};
+};
+
+// Member views. Each holds a pointer to the object's map (null for
+// non-objects) and projects its iterator onto the key or the value.
+class Json::KeyRange {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::string_view;
+
+        iterator() noexcept = default;
+        iterator& operator++() noexcept { ++it_; return *this; }
+        iterator operator++(int) noexcept { iterator tmp(*this); ++it_; return tmp; }
+        [[nodiscard]] reference operator*() const noexcept { return it_->first; }
+        bool operator==(const iterator& other) const noexcept { return it_ == other.it_; }
+
+    private:
+        friend class KeyRange;
+        explicit iterator(Impl::Object::const_iterator it) noexcept : it_(it) {}
+        Impl::Object::const_iterator it_{};
+    };
+
+    [[nodiscard]] iterator begin() const noexcept { return obj_ ? iterator(obj_->begin()) : iterator(); }
+    [[nodiscard]] iterator end() const noexcept { return obj_ ? iterator(obj_->end()) : iterator(); }
+    [[nodiscard]] size_t size() const noexcept { return obj_ ? obj_->size() : 0; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    friend class Json;
+    explicit KeyRange(const Impl::Object* obj) noexcept : obj_(obj) {}
+    const Impl::Object* obj_;
+};
+
+class Json::ValueRange {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Json;
+        using difference_type = std::ptrdiff_t;
+        using pointer = Json*;
+        using reference = Json&;
+
+        iterator() noexcept = default;
+        iterator& operator++() noexcept { ++it_; return *this; }
+        iterator operator++(int) noexcept { iterator tmp(*this); ++it_; return tmp; }
+        [[nodiscard]] reference operator*() const noexcept { return it_->second; }
+        [[nodiscard]] pointer operator->() const noexcept { return &it_->second; }
+        bool operator==(const iterator& other) const noexcept { return it_ == other.it_; }
+
+    private:
+        friend class ValueRange;
+        explicit iterator(Impl::Object::iterator it) noexcept : it_(it) {}
+        Impl::Object::iterator it_{};
+    };
+
+    [[nodiscard]] iterator begin() const noexcept { return obj_ ? iterator(obj_->begin()) : iterator(); }
+    [[nodiscard]] iterator end() const noexcept { return obj_ ? iterator(obj_->end()) : iterator(); }
+    [[nodiscard]] size_t size() const noexcept { return obj_ ? obj_->size() : 0; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    friend class Json;
+    explicit ValueRange(Impl::Object* obj) noexcept : obj_(obj) {}
+    Impl::Object* obj_;
+};
+
+class Json::ConstValueRange {
+public:
+    class iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Json;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Json*;
+        using reference = const Json&;
+
+        iterator() noexcept = default;
+        iterator& operator++() noexcept { ++it_; return *this; }
+        iterator operator++(int) noexcept { iterator tmp(*this); ++it_; return tmp; }
+        [[nodiscard]] reference operator*() const noexcept { return it_->second; }
+        [[nodiscard]] pointer operator->() const noexcept { return &it_->second; }
+        bool operator==(const iterator& other) const noexcept { return it_ == other.it_; }
+
+    private:
+        friend class ConstValueRange;
+        explicit iterator(Impl::Object::const_iterator it) noexcept : it_(it) {}
+        Impl::Object::const_iterator it_{};
+    };
+
+    [[nodiscard]] iterator begin() const noexcept { return obj_ ? iterator(obj_->begin()) : iterator(); }
+    [[nodiscard]] iterator end() const noexcept { return obj_ ? iterator(obj_->end()) : iterator(); }
+    [[nodiscard]] size_t size() const noexcept { return obj_ ? obj_->size() : 0; }
+    [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+private:
+    friend class Json;
+    explicit ConstValueRange(const Impl::Object* obj) noexcept : obj_(obj) {}
+    const Impl::Object* obj_;
+};
+
+#endif // JSON_INLINE_H
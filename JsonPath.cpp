@@ -0,0 +1,966 @@
+#include "Json.h"
+#include "JsonImpl.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <functional>
+#include <istream>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+// JSONPath compilation and evaluation.
+//
+// An expression is parsed once into a list of steps. Each step applies its
+// selectors either to the children of the current nodes (.name, [0]) or, for
+// recursive descent (..), to the children of every node below them. Filter
+// selectors compile to a tree of closures over the candidate node (@) and the
+// document root ($). Evaluation walks the DOM through Find/Elements/Values
+// with pre-hashed keys and collects pointers, so no member or key is copied.
+//
+// The same program also drives Json::Scan, which matches it against JSON text
+// while tokenizing: each container carries the set of step positions still
+// live for it, children with no live positions are skipped as raw text, and
+// only matched values are parsed.
+
+struct Json::Path::Program {
+    using Predicate = std::function<bool(const Json& node, const Json& root)>;
+
+    struct Selector {
+        enum class Type { Name, Index, Wildcard, Slice, Filter };
+        Type type = Type::Name;
+        std::string name;
+        size_t hash = 0;
+        int64_t index = 0;
+        std::optional<int64_t> start;
+        std::optional<int64_t> end;
+        int64_t step = 1;
+        Predicate filter;
+
+        [[nodiscard]] KeyView Key() const noexcept { return KeyView(name, hash); }
+    };
+
+    struct Step {
+        bool descendant = false;
+        std::vector<Selector> selectors;
+    };
+
+    std::vector<Step> steps;
+    bool uses_root = false;  // A filter refers to $, so evaluation needs the whole document
+
+    // True if every step selects at most one node (names and indices only)
+    [[nodiscard]] bool Singular() const noexcept {
+        for (const auto& step : steps) {
+            if (step.descendant || step.selectors.size() != 1) return false;
+            auto type = step.selectors.front().type;
+            if (type != Selector::Type::Name && type != Selector::Type::Index) return false;
+        }
+        return true;
+    }
+
+    // Applies steps[first..] to from
+    void Evaluate(const Json& from, const Json& root, std::vector<const Json*>& out, size_t first = 0) const {
+        if (first >= steps.size()) {
+            out.push_back(&from);
+            return;
+        }
+        std::vector<const Json*> current{&from};
+        std::vector<const Json*> next;
+        for (size_t s = first; s < steps.size(); ++s) {
+            auto& target = s + 1 == steps.size() ? out : next;
+            for (const Json* node : current) {
+                if (steps[s].descendant) {
+                    ApplyDescendant(steps[s], *node, root, target);
+                } else {
+                    Apply(steps[s], *node, root, target);
+                }
+            }
+            if (s + 1 == steps.size()) break;
+            current.swap(next);
+            next.clear();
+            if (current.empty()) break;
+        }
+    }
+
+    // First match of a relative path; used for filter operands
+    [[nodiscard]] const Json* First(const Json& from, const Json& root) const {
+        if (Singular()) {
+            const Json* node = &from;
+            for (const auto& step : steps) {
+                node = SelectOne(step.selectors.front(), *node);
+                if (!node) return nullptr;
+            }
+            return node;
+        }
+        std::vector<const Json*> matches;
+        Evaluate(from, root, matches);
+        return matches.empty() ? nullptr : matches.front();
+    }
+
+    static const Json* SelectOne(const Selector& selector, const Json& node) noexcept {
+        if (selector.type == Selector::Type::Name) return node.Find(selector.Key());
+        std::span<const Json> items = node.Elements();
+        const int64_t size = static_cast<int64_t>(items.size());
+        const int64_t i = selector.index < 0 ? selector.index + size : selector.index;
+        return i >= 0 && i < size ? &items[static_cast<size_t>(i)] : nullptr;
+    }
+
+    static void ApplyDescendant(const Step& step, const Json& node, const Json& root, std::vector<const Json*>& out) {
+        Apply(step, node, root, out);
+        if (node.IsArray()) {
+            for (const Json& child : node.Elements()) ApplyDescendant(step, child, root, out);
+        } else if (node.IsObject()) {
+            for (const Json& child : node.Values()) ApplyDescendant(step, child, root, out);
+        }
+    }
+
+    static void Apply(const Step& step, const Json& node, const Json& root, std::vector<const Json*>& out) {
+        for (const auto& selector : step.selectors) {
+            switch (selector.type) {
+                case Selector::Type::Name:
+                case Selector::Type::Index:
+                    if (const Json* child = SelectOne(selector, node)) out.push_back(child);
+                    break;
+                case Selector::Type::Wildcard:
+                    if (node.IsArray()) {
+                        for (const Json& child : node.Elements()) out.push_back(&child);
+                    } else if (node.IsObject()) {
+                        for (const Json& child : node.Values()) out.push_back(&child);
+                    }
+                    break;
+                case Selector::Type::Slice:
+                    ApplySlice(selector, node, out);
+                    break;
+                case Selector::Type::Filter:
+                    if (node.IsArray()) {
+                        for (const Json& child : node.Elements()) {
+                            if (selector.filter(child, root)) out.push_back(&child);
+                        }
+                    } else if (node.IsObject()) {
+                        for (const Json& child : node.Values()) {
+                            if (selector.filter(child, root)) out.push_back(&child);
+                        }
+                    }
+                    break;
+            }
+        }
+    }
+
+    // Python-style slice bounds
+    static void ApplySlice(const Selector& selector, const Json& node, std::vector<const Json*>& out) {
+        std::span<const Json> items = node.Elements();
+        const int64_t size = static_cast<int64_t>(items.size());
+        const int64_t step = selector.step;
+        if (step == 0 || size == 0) return;
+
+        auto clamp = [size](int64_t value, int64_t lo, int64_t hi) {
+            if (value < 0) value += size;
+            return std::min(std::max(value, lo), hi);
+        };
+        if (step > 0) {
+            const int64_t first = selector.start ? clamp(*selector.start, 0, size) : 0;
+            const int64_t last = selector.end ? clamp(*selector.end, 0, size) : size;
+            for (int64_t i = first; i < last; i += step) {
+                out.push_back(&items[static_cast<size_t>(i)]);
+                if (step >= last - i) break;  // Stop before i + step can overflow
+            }
+        } else {
+            const int64_t first = selector.start ? clamp(*selector.start, -1, size - 1) : size - 1;
+            const int64_t last = selector.end ? clamp(*selector.end, -1, size - 1) : -1;
+            for (int64_t i = first; i > last; i += step) {
+                out.push_back(&items[static_cast<size_t>(i)]);
+                if (step <= last - i) break;
+            }
+        }
+    }
+};
+
+namespace {
+
+using Program = Json::Path::Program;
+using Selector = Program::Selector;
+
+// Filter operands evaluate to a value in the document, a literal, or nothing
+using Operand = std::function<const Json*(const Json& node, const Json& root)>;
+
+class PathParser {
+public:
+    explicit PathParser(std::string_view text) : text_(text) {}
+
+    // Parses "$..." (or "@..." inside filters) up to the end of a path
+    Program ParsePath(bool relative) {
+        Program program;
+        SkipSpace();
+        if (!Consume(relative ? '@' : '$')) {
+            Fail(relative ? "expected '@'" : "expected '$'");
+        }
+        while (pos_ < text_.size()) {
+            if (Peek("..")) {
+                pos_ += 2;
+                Program::Step step;
+                step.descendant = true;
+                if (Peek('[')) {
+                    ParseBracket(step);
+                } else {
+                    step.selectors.push_back(ParseDotSelector());
+                }
+                program.steps.push_back(std::move(step));
+            } else if (Peek('.')) {
+                ++pos_;
+                Program::Step step;
+                step.selectors.push_back(ParseDotSelector());
+                program.steps.push_back(std::move(step));
+            } else if (Peek('[')) {
+                Program::Step step;
+                ParseBracket(step);
+                program.steps.push_back(std::move(step));
+            } else {
+                break;
+            }
+        }
+        return program;
+    }
+
+    [[nodiscard]] bool UsesRoot() const noexcept { return uses_root_; }
+
+    void ExpectEnd() {
+        SkipSpace();
+        if (pos_ != text_.size()) Fail("unexpected character");
+    }
+
+private:
+    Selector ParseDotSelector() {
+        Selector selector;
+        if (Consume('*')) {
+            selector.type = Selector::Type::Wildcard;
+            return selector;
+        }
+        const size_t begin = pos_;
+        while (pos_ < text_.size() && IsNameChar(text_[pos_])) ++pos_;
+        if (pos_ == begin) Fail("expected member name");
+        return NameSelector(std::string(text_.substr(begin, pos_ - begin)));
+    }
+
+    void ParseBracket(Program::Step& step) {
+        Expect('[');
+        do {
+            SkipSpace();
+            step.selectors.push_back(ParseBracketSelector());
+            SkipSpace();
+        } while (Consume(','));
+        Expect(']');
+    }
+
+    Selector ParseBracketSelector() {
+        if (Peek('\'') || Peek('"')) return NameSelector(ParseString());
+        if (Consume('*')) {
+            Selector selector;
+            selector.type = Selector::Type::Wildcard;
+            return selector;
+        }
+        if (Consume('?')) {
+            Selector selector;
+            selector.type = Selector::Type::Filter;
+            SkipSpace();
+            selector.filter = ParseOr();
+            return selector;
+        }
+
+        // Index or slice
+        Selector selector;
+        std::optional<int64_t> first = ParseOptionalInt();
+        SkipSpace();
+        if (!Consume(':')) {
+            if (!first) Fail("expected selector");
+            selector.type = Selector::Type::Index;
+            selector.index = *first;
+            return selector;
+        }
+        selector.type = Selector::Type::Slice;
+        selector.start = first;
+        SkipSpace();
+        selector.end = ParseOptionalInt();
+        SkipSpace();
+        if (Consume(':')) {
+            SkipSpace();
+            selector.step = ParseOptionalInt().value_or(1);
+        }
+        return selector;
+    }
+
+    static Selector NameSelector(std::string name) {
+        Selector selector;
+        selector.type = Selector::Type::Name;
+        selector.hash = Json::KeyView::Hash(name);
+        selector.name = std::move(name);
+        return selector;
+    }
+
+    // Filter expressions: || binds loosest, then &&, then !, then comparisons
+    Program::Predicate ParseOr() {
+        Program::Predicate lhs = ParseAnd();
+        while (SkipSpace(), Peek("||")) {
+            pos_ += 2;
+            Program::Predicate rhs = ParseAnd();
+            lhs = [lhs = std::move(lhs), rhs = std::move(rhs)](const Json& node, const Json& root) {
+                return lhs(node, root) || rhs(node, root);
+            };
+        }
+        return lhs;
+    }
+
+    Program::Predicate ParseAnd() {
+        Program::Predicate lhs = ParseUnary();
+        while (SkipSpace(), Peek("&&")) {
+            pos_ += 2;
+            Program::Predicate rhs = ParseUnary();
+            lhs = [lhs = std::move(lhs), rhs = std::move(rhs)](const Json& node, const Json& root) {
+                return lhs(node, root) && rhs(node, root);
+            };
+        }
+        return lhs;
+    }
+
+    Program::Predicate ParseUnary() {
+        SkipSpace();
+        if (Peek('!') && !Peek("!=")) {
+            ++pos_;
+            Program::Predicate operand = ParseUnary();
+            return [operand = std::move(operand)](const Json& node, const Json& root) {
+                return !operand(node, root);
+            };
+        }
+        if (Consume('(')) {
+            Program::Predicate inner = ParseOr();
+            SkipSpace();
+            Expect(')');
+            return inner;
+        }
+        return ParseComparison();
+    }
+
+    Program::Predicate ParseComparison() {
+        bool is_path = false;
+        Operand lhs = ParseOperand(is_path);
+        SkipSpace();
+
+        enum class Op { Eq, Ne, Lt, Le, Gt, Ge };
+        Op op;
+        if (Peek("==")) { op = Op::Eq; pos_ += 2; }
+        else if (Peek("!=")) { op = Op::Ne; pos_ += 2; }
+        else if (Peek("<=")) { op = Op::Le; pos_ += 2; }
+        else if (Peek(">=")) { op = Op::Ge; pos_ += 2; }
+        else if (Peek('<')) { op = Op::Lt; ++pos_; }
+        else if (Peek('>')) { op = Op::Gt; ++pos_; }
+        else {
+            // No operator: a path tests for existence, a literal for truth
+            if (is_path) {
+                return [lhs = std::move(lhs)](const Json& node, const Json& root) {
+                    return lhs(node, root) != nullptr;
+                };
+            }
+            return [lhs = std::move(lhs)](const Json& node, const Json& root) {
+                const Json* value = lhs(node, root);
+                const bool* truth = value ? value->GetIf<bool>() : nullptr;
+                return truth && *truth;
+            };
+        }
+
+        bool rhs_is_path = false;
+        Operand rhs = ParseOperand(rhs_is_path);
+        return [lhs = std::move(lhs), rhs = std::move(rhs), op](const Json& node, const Json& root) {
+            const Json* a = lhs(node, root);
+            const Json* b = rhs(node, root);
+            if (op == Op::Eq || op == Op::Ne) {
+                const bool equal = (!a || !b) ? a == b : *a == *b;
+                return op == Op::Eq ? equal : !equal;
+            }
+            if (!a || !b) return false;
+            int order;
+            if (const double* x = a->GetIf<double>(), *y = b->GetIf<double>(); x && y) {
+                order = *x < *y ? -1 : (*x > *y ? 1 : 0);
+            } else if (const std::string* x = a->GetIf<std::string>(), *y = b->GetIf<std::string>(); x && y) {
+                const int c = x->compare(*y);
+                order = c < 0 ? -1 : (c > 0 ? 1 : 0);
+            } else {
+                return false;  // Ordering is only defined for two numbers or two strings
+            }
+            switch (op) {
+                case Op::Lt: return order < 0;
+                case Op::Le: return order <= 0;
+                case Op::Gt: return order > 0;
+                default: return order >= 0;
+            }
+        };
+    }
+
+    Operand ParseOperand(bool& is_path) {
+        SkipSpace();
+        is_path = Peek('@') || Peek('$');
+        if (is_path) {
+            const bool relative = Peek('@');
+            uses_root_ = uses_root_ || !relative;
+            auto program = std::make_shared<const Program>(ParsePath(relative));
+            if (relative) {
+                return [program](const Json& node, const Json& root) { return program->First(node, root); };
+            }
+            return [program](const Json&, const Json& root) { return program->First(root, root); };
+        }
+
+        Json literal;
+        if (Peek('\'') || Peek('"')) {
+            literal = Json(ParseString());
+        } else if (ConsumeWord("true")) {
+            literal = Json(true);
+        } else if (ConsumeWord("false")) {
+            literal = Json(false);
+        } else if (ConsumeWord("null")) {
+            literal = Json();
+        } else {
+            double number = 0;
+            auto [ptr, ec] = std::from_chars(text_.data() + pos_, text_.data() + text_.size(), number);
+            if (ec != std::errc()) Fail("expected operand");
+            pos_ = static_cast<size_t>(ptr - text_.data());
+            literal = Json(number);
+        }
+        auto value = std::make_shared<const Json>(std::move(literal));
+        return [value](const Json&, const Json&) { return value.get(); };
+    }
+
+    std::string ParseString() {
+        const char quote = text_[pos_++];
+        std::string out;
+        while (pos_ < text_.size() && text_[pos_] != quote) {
+            char c = text_[pos_++];
+            if (c != '\\') {
+                out += c;
+                continue;
+            }
+            if (pos_ >= text_.size()) break;
+            c = text_[pos_++];
+            switch (c) {
+                case 'b': out += '\b'; break;
+                case 'f': out += '\f'; break;
+                case 'n': out += '\n'; break;
+                case 'r': out += '\r'; break;
+                case 't': out += '\t'; break;
+                case 'u': {
+                    unsigned code = ParseHex4();
+                    if (code >= 0xDC00 && code <= 0xDFFF) Fail("unpaired low surrogate");
+                    if (code >= 0xD800 && code <= 0xDBFF) {
+                        // Characters above U+FFFF are written as a high/low surrogate pair
+                        if (text_.substr(pos_, 2) != "\\u") Fail("unpaired high surrogate");
+                        pos_ += 2;
+                        const unsigned low = ParseHex4();
+                        if (low < 0xDC00 || low > 0xDFFF) Fail("unpaired high surrogate");
+                        code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                    }
+                    AppendUtf8(out, code);
+                    break;
+                }
+                default: out += c; break;  // \\ \' \" \/
+            }
+        }
+        if (!Consume(quote)) Fail("unterminated string");
+        return out;
+    }
+
+    unsigned ParseHex4() {
+        if (pos_ + 4 > text_.size()) Fail("truncated \\u escape");
+        unsigned code = 0;
+        auto [ptr, ec] = std::from_chars(text_.data() + pos_, text_.data() + pos_ + 4, code, 16);
+        if (ec != std::errc() || ptr != text_.data() + pos_ + 4) Fail("invalid \\u escape");
+        pos_ += 4;
+        return code;
+    }
+
+    static void AppendUtf8(std::string& out, unsigned code) {
+        if (code < 0x80) {
+            out += static_cast<char>(code);
+        } else if (code < 0x800) {
+            out += static_cast<char>(0xC0 | (code >> 6));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else if (code < 0x10000) {
+            out += static_cast<char>(0xE0 | (code >> 12));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        } else {
+            out += static_cast<char>(0xF0 | (code >> 18));
+            out += static_cast<char>(0x80 | ((code >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((code >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (code & 0x3F));
+        }
+    }
+
+    std::optional<int64_t> ParseOptionalInt() {
+        int64_t value = 0;
+        auto [ptr, ec] = std::from_chars(text_.data() + pos_, text_.data() + text_.size(), value);
+        if (ec != std::errc()) return std::nullopt;
+        pos_ = static_cast<size_t>(ptr - text_.data());
+        return value;
+    }
+
+    static bool IsNameChar(char c) noexcept {
+        const auto u = static_cast<unsigned char>(c);
+        return std::isalnum(u) || c == '_' || u >= 0x80;
+    }
+
+    bool ConsumeWord(std::string_view word) {
+        if (text_.substr(pos_, word.size()) != word) return false;
+        if (pos_ + word.size() < text_.size() && IsNameChar(text_[pos_ + word.size()])) return false;
+        pos_ += word.size();
+        return true;
+    }
+
+    void SkipSpace() noexcept {
+        while (pos_ < text_.size() && (text_[pos_] == ' ' || text_[pos_] == '\t')) ++pos_;
+    }
+
+    [[nodiscard]] bool Peek(char c) const noexcept { return pos_ < text_.size() && text_[pos_] == c; }
+    [[nodiscard]] bool Peek(std::string_view s) const noexcept { return text_.substr(pos_, s.size()) == s; }
+
+    bool Consume(char c) noexcept {
+        if (!Peek(c)) return false;
+        ++pos_;
+        return true;
+    }
+
+    void Expect(char c) {
+        if (!Consume(c)) Fail(std::string("expected '") + c + "'");
+    }
+
+    [[noreturn]] void Fail(const std::string& what) const {
+        throw JsonException("Invalid JSONPath '" + std::string(text_) + "' at position " +
+                            std::to_string(pos_) + ": " + what);
+    }
+
+    std::string_view text_;
+    size_t pos_ = 0;
+    bool uses_root_ = false;
+};
+
+// Matches a program against JSON text. Live step positions for the value being
+// scanned sit at the top of a shared stack; a position equal to steps.size()
+// means the value itself matches. Skipped subtrees are only checked for
+// balanced strings and brackets, matched ones are fully parsed.
+class StreamScanner {
+public:
+    StreamScanner(std::string_view text, const Program& program, size_t first_line,
+                  const std::function<void(Json&&)>& on_match)
+        : text_(text), program_(program), first_line_(first_line), on_match_(on_match) {
+        streamable_.reserve(program.steps.size());
+        for (const auto& step : program.steps) streamable_.push_back(Streamable(step));
+    }
+
+    size_t Run() {
+        states_.push_back({0, 1});
+        SkipSpace();
+        Walk(0, 1);
+        SkipSpace();
+        if (pos_ != text_.size()) Fail("Unexpected characters after JSON value");
+        return matches_;
+    }
+
+private:
+    // True if a child can be selected from its key or index alone
+    static bool Streamable(const Program::Step& step) noexcept {
+        for (const auto& selector : step.selectors) {
+            switch (selector.type) {
+                case Selector::Type::Name:
+                case Selector::Type::Wildcard:
+                    break;
+                case Selector::Type::Index:
+                    if (selector.index < 0) return false;
+                    break;
+                case Selector::Type::Slice:
+                    if (selector.step <= 0 || selector.start.value_or(0) < 0 || selector.end.value_or(0) < 0) {
+                        return false;
+                    }
+                    break;
+                case Selector::Type::Filter:
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    static bool Selects(const Selector& selector, const std::string_view* key, int64_t index) noexcept {
+        switch (selector.type) {
+            case Selector::Type::Name:
+                return key && *key == selector.name;
+            case Selector::Type::Wildcard:
+                return true;
+            case Selector::Type::Index:
+                return !key && index == selector.index;
+            case Selector::Type::Slice: {
+                if (key) return false;
+                const int64_t start = selector.start.value_or(0);
+                return index >= start && (!selector.end || index < *selector.end) &&
+                       (index - start) % selector.step == 0;
+            }
+            case Selector::Type::Filter:
+                return false;
+        }
+        return false;
+    }
+
+    // Scans the value at pos_ with the live positions states_[offset, offset + count)
+    void Walk(size_t offset, size_t count) {
+        const size_t final_step = program_.steps.size();
+        bool materialize = false;
+        bool descend = false;
+        for (size_t i = offset; i < offset + count; ++i) {
+            const size_t s = states_[i].step;
+            if (s == final_step || !streamable_[s]) {
+                materialize = true;
+            } else {
+                descend = true;
+            }
+        }
+
+        const size_t begin = pos_;
+        if (materialize) {
+            SkipValue();
+            Json node = ParseSpan(begin, pos_);
+            for (size_t i = offset; i < offset + count; ++i) {
+                const auto [s, times] = states_[i];
+                if (s == final_step) {
+                    for (size_t t = 0; t < times; ++t) Emit(Json(node));
+                } else if (!streamable_[s]) {
+                    // Filters and from-the-end positions need the whole node
+                    std::vector<const Json*> found;
+                    program_.Evaluate(node, node, found, s);
+                    for (const Json* match : found) {
+                        for (size_t t = 0; t < times; ++t) Emit(Json(*match));
+                    }
+                }
+            }
+            if (!descend) return;
+            pos_ = begin;
+        }
+
+        if (!descend || pos_ >= text_.size()) {
+            SkipValue();
+        } else if (text_[pos_] == '{') {
+            WalkObject(offset, count);
+        } else if (text_[pos_] == '[') {
+            WalkArray(offset, count);
+        } else {
+            SkipValue();
+        }
+    }
+
+    void WalkObject(size_t offset, size_t count) {
+        ++pos_;
+        SkipSpace();
+        if (Consume('}')) return;
+        while (true) {
+            SkipSpace();
+            if (!Peek('"')) Fail("Expected string key");
+            const std::string_view key = ScanKey();
+            SkipSpace();
+            if (!Consume(':')) Fail("Expected ':' after object key");
+            SkipSpace();
+            WalkChild(offset, count, &key, 0);
+            SkipSpace();
+            if (Consume(',')) continue;
+            if (Consume('}')) return;
+            Fail("Expected ',' or '}' in object");
+        }
+    }
+
+    void WalkArray(size_t offset, size_t count) {
+        ++pos_;
+        SkipSpace();
+        if (Consume(']')) return;
+        for (int64_t index = 0;; ++index) {
+            SkipSpace();
+            WalkChild(offset, count, nullptr, index);
+            SkipSpace();
+            if (Consume(',')) continue;
+            if (Consume(']')) return;
+            Fail("Expected ',' or ']' in array");
+        }
+    }
+
+    // Pushes the child's live positions, then walks or skips it
+    void WalkChild(size_t offset, size_t count, const std::string_view* key, int64_t index) {
+        const size_t final_step = program_.steps.size();
+        const size_t child = states_.size();
+        // Positions reached along several routes are merged, adding up their
+        // multiplicities, so each route still yields its own match as in Query
+        auto add = [&](size_t s, size_t times) {
+            for (size_t i = child; i < states_.size(); ++i) {
+                if (states_[i].step == s) {
+                    states_[i].times += times;
+                    return;
+                }
+            }
+            states_.push_back({s, times});
+        };
+        for (size_t i = offset; i < offset + count; ++i) {
+            const auto [s, times] = states_[i];
+            if (s == final_step || !streamable_[s]) continue;
+            const auto& step = program_.steps[s];
+            if (step.descendant) add(s, times);
+            size_t selected = 0;
+            for (const auto& selector : step.selectors) {
+                if (Selects(selector, key, index)) ++selected;
+            }
+            if (selected) add(s + 1, times * selected);
+        }
+        if (states_.size() == child) {
+            SkipValue();
+        } else {
+            Walk(child, states_.size() - child);
+        }
+        states_.resize(child);
+    }
+
+    // Reads the key at pos_; escaped keys are decoded into key_buffer_
+    std::string_view ScanKey() {
+        const size_t begin = pos_;
+        SkipString();
+        const std::string_view raw = text_.substr(begin + 1, pos_ - begin - 2);
+        if (raw.find('\\') == std::string_view::npos) return raw;
+        key_buffer_ = ParseSpan(begin, pos_).Get<std::string>();
+        return key_buffer_;
+    }
+
+    // Skips the value at pos_, checking it against the JSON grammar without
+    // building it. Containers are tracked on an explicit stack of expected
+    // closing brackets, so deep nesting does not recurse.
+    void SkipValue() {
+        skip_stack_.clear();
+        while (true) {
+            if (pos_ >= text_.size()) Fail("Unexpected end of input");
+            const char c = text_[pos_];
+            if (c == '{' || c == '[') {
+                const char close = c == '{' ? '}' : ']';
+                ++pos_;
+                SkipSpace();
+                if (!Consume(close)) {
+                    skip_stack_.push_back(close);
+                    if (close == '}') SkipKey();
+                    continue;
+                }
+            } else if (c == '"') {
+                SkipString();
+            } else {
+                SkipScalar();
+            }
+
+            // Close finished containers until one expects another element
+            while (true) {
+                if (skip_stack_.empty()) return;
+                SkipSpace();
+                const char close = skip_stack_.back();
+                if (Consume(',')) {
+                    SkipSpace();
+                    if (close == '}') SkipKey();
+                    break;
+                }
+                if (!Consume(close)) Fail(close == '}' ? "Expected ',' or '}' in object" : "Expected ',' or ']' in array");
+                skip_stack_.pop_back();
+            }
+        }
+    }
+
+    // Skips `"key" :` and the space before the member value
+    void SkipKey() {
+        if (!Peek('"')) Fail("Expected string key");
+        SkipString();
+        SkipSpace();
+        if (!Consume(':')) Fail("Expected ':' after object key");
+        SkipSpace();
+    }
+
+    void SkipScalar() {
+        for (std::string_view literal : {std::string_view("true"), std::string_view("false"), std::string_view("null")}) {
+            if (text_.substr(pos_, literal.size()) == literal) {
+                pos_ += literal.size();
+                EndScalar();
+                return;
+            }
+        }
+        if (!Peek('-') && !IsDigit()) Fail("Unexpected character");
+
+        // -?(0|[1-9][0-9]*)(.[0-9]+)?([eE][+-]?[0-9]+)?
+        Consume('-');
+        if (!Consume('0') && !SkipDigits()) Fail("Invalid number");
+        if (Consume('.') && !SkipDigits()) Fail("Invalid number");
+        if (Consume('e') || Consume('E')) {
+            if (!Consume('+')) Consume('-');
+            if (!SkipDigits()) Fail("Invalid number");
+        }
+        EndScalar();
+    }
+
+    void EndScalar() const {
+        if (pos_ < text_.size() && !IsDelimiter(text_[pos_])) Fail("Invalid value");
+    }
+
+    [[nodiscard]] bool IsDigit() const noexcept { return pos_ < text_.size() && text_[pos_] >= '0' && text_[pos_] <= '9'; }
+
+    bool SkipDigits() noexcept {
+        const size_t begin = pos_;
+        while (IsDigit()) ++pos_;
+        return pos_ != begin;
+    }
+
+    void SkipString() {
+        ++pos_;
+        while (true) {
+            if (pos_ >= text_.size()) Fail("Unterminated string");
+            const auto c = static_cast<unsigned char>(text_[pos_]);
+            if (c == '"') {
+                ++pos_;
+                return;
+            }
+            if (c < 0x20) Fail("Invalid character in string");
+            if (c == '\\') {
+                ++pos_;
+                if (pos_ >= text_.size()) Fail("Unterminated string escape");
+                const char escaped = text_[pos_];
+                if (escaped == 'u') {
+                    for (int i = 0; i < 4; ++i) {
+                        ++pos_;
+                        if (pos_ >= text_.size() || !std::isxdigit(static_cast<unsigned char>(text_[pos_]))) {
+                            Fail("Invalid unicode escape");
+                        }
+                    }
+                } else if (std::string_view("\"\\/bfnrt").find(escaped) == std::string_view::npos) {
+                    Fail("Invalid escape sequence");
+                }
+            }
+            ++pos_;
+        }
+    }
+
+    Json ParseSpan(size_t begin, size_t end) const { return Json::Parse(text_.substr(begin, end - begin)); }
+
+    void Emit(Json&& value) {
+        ++matches_;
+        on_match_(std::move(value));
+    }
+
+    static bool IsDelimiter(char c) noexcept {
+        return c == ',' || c == ']' || c == '}' || c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    void SkipSpace() noexcept {
+        while (pos_ < text_.size() &&
+               (text_[pos_] == ' ' || text_[pos_] == '\t' || text_[pos_] == '\n' || text_[pos_] == '\r')) {
+            ++pos_;
+        }
+    }
+
+    [[nodiscard]] bool Peek(char c) const noexcept { return pos_ < text_.size() && text_[pos_] == c; }
+
+    bool Consume(char c) noexcept {
+        if (!Peek(c)) return false;
+        ++pos_;
+        return true;
+    }
+
+    [[noreturn]] void Fail(const std::string& message) const {
+        size_t line = first_line_;
+        size_t column = 1;
+        for (size_t i = 0; i < pos_ && i < text_.size(); ++i) {
+            if (text_[i] == '\n') {
+                ++line;
+                column = 1;
+            } else {
+                ++column;
+            }
+        }
+        throw JsonParseError(message, line, column);
+    }
+
+    std::string_view text_;
+    const Program& program_;
+    size_t first_line_;
+    const std::function<void(Json&&)>& on_match_;
+    std::vector<char> streamable_;
+    // A live step position and the number of routes that reached it (a union
+    // can select the same child more than once)
+    struct LiveStep {
+        size_t step;
+        size_t times;
+    };
+    std::vector<LiveStep> states_;
+    std::vector<char> skip_stack_;  // Closing brackets of the containers SkipValue is inside
+    std::string key_buffer_;
+    size_t pos_ = 0;
+    size_t matches_ = 0;
+};
+
+size_t ScanText(std::string_view text, const Program& program, size_t first_line,
+                const std::function<void(Json&&)>& on_match) {
+    if (program.uses_root) {
+        // Filters comparing against $ need the document before they can decide
+        std::vector<const Json*> found;
+        Json document = Json::Parse(text);
+        program.Evaluate(document, document, found);
+        for (const Json* match : found) on_match(Json(*match));
+        return found.size();
+    }
+    return StreamScanner(text, program, first_line, on_match).Run();
+}
+
+bool IsBlank(std::string_view line) noexcept {
+    return line.find_first_not_of(" \t\r") == std::string_view::npos;
+}
+
+} // namespace
+
+Json::Path::Path(std::string_view expression) : text_(expression) {
+    PathParser parser(text_);
+    auto program = std::make_shared<Program>(parser.ParsePath(false));
+    parser.ExpectEnd();
+    program->uses_root = parser.UsesRoot();
+    program_ = std::move(program);
+}
+
+std::vector<const Json*> Json::Query(const Path& path) const {
+    std::vector<const Json*> out;
+    Query(path, out);
+    return out;
+}
+
+void Json::Query(const Path& path, std::vector<const Json*>& out) const {
+    ensure_valid();
+    path.program_->Evaluate(*this, *this, out);
+}
+
+size_t Json::Scan(std::string_view text, const Path& path, const std::function<void(Json&&)>& on_match) {
+    return ScanText(text, *path.program_, 1, on_match);
+}
+
+size_t Json::ScanLines(std::string_view text, const Path& path,
+                       const std::function<void(size_t line, Json&&)>& on_match) {
+    size_t matches = 0;
+    size_t line = 1;
+    for (size_t begin = 0; begin < text.size(); ++line) {
+        size_t end = text.find('\n', begin);
+        if (end == std::string_view::npos) end = text.size();
+        const std::string_view record = text.substr(begin, end - begin);
+        if (!IsBlank(record)) {
+            matches += ScanText(record, *path.program_, line, [&](Json&& value) { on_match(line, std::move(value)); });
+        }
+        begin = end + 1;
+    }
+    return matches;
+}
+
+size_t Json::ScanLines(std::istream& input, const Path& path,
+                       const std::function<void(size_t line, Json&&)>& on_match) {
+    size_t matches = 0;
+    std::string record;
+    for (size_t line = 1; std::getline(input, record); ++line) {
+        if (IsBlank(record)) continue;
+        matches += ScanText(record, *path.program_, line, [&](Json&& value) { on_match(line, std::move(value)); });
+    }
+    return matches;
+}
@@ -0,0 +1,389 @@
+#include "../Json.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <unordered_set>
+#include <optional>
+#include <utility>
+
+// Test result tracking
+struct TestResults {
+    int passed = 0;
+    int failed = 0;
+    std::vector<std::string> failures;
+
+    void expect(bool condition, const std::string& test_name) {
+        if (condition) {
+            passed++;
+            std::cout << "✓ " << test_name << std::endl;
+        } else {
+            failed++;
+            failures.push_back(test_name);
+            std::cout << "✗ " << test_name << std::endl;
+        }
+    }
+
+    void print_summary() {
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        if (!failures.empty()) {
+            std::cout << "Failed tests:" << std::endl;
+            for (const auto& failure : failures) {
+                std::cout << "  - " << failure << std::endl;
+            }
+        }
+    }
+};
+
+TestResults results;
+
+void testKeyLookups() {
+    std::cout << "\n=== Testing Key Lookups ===\n";
+
+    try {
+        const std::string long_key = "a_key_that_is_definitely_longer_than_sso";
+        Json obj = Json::Object();
+        obj[long_key] = 1;
+        obj["short"] = 2;
+
+        std::string_view view = long_key;
+        results.expect(obj.Contains(view) && obj[view].Get<int>() == 1, "string_view lookup of long key");
+        results.expect(Json::Key::Hash(long_key) == Json::Key(long_key).HashValue(), "Key caches Hash()");
+
+        const Json::Key price("price");
+        std::vector<Json> records;
+        for (int i = 0; i < 100; ++i) {
+            Json record = Json::Object();
+            record["price"] = i;
+            records.push_back(std::move(record));
+        }
+        int total = 0;
+        for (const Json& record : records) {
+            if (record.Contains(price)) {
+                total += record[price].Get<int>();
+            }
+        }
+        results.expect(total == 4950, "Key handle reused across objects");
+
+        Json target = Json::Object();
+        target[price] = 5;
+        results.expect(target["price"].Get<int>() == 5, "Key handle inserts members");
+        target.Remove(price);
+        results.expect(!target.Contains("price") && target.Size() == 0, "Key handle removes members");
+
+        const Json& const_obj = obj;
+        bool threw = false;
+        try {
+            (void)const_obj[Json::Key("missing")];
+        } catch (const std::exception&) {
+            threw = true;
+        }
+        results.expect(threw, "Const Key lookup of missing member throws");
+
+        Json many = Json::Object();
+        for (int i = 0; i < 10000; ++i) {
+            many["key_" + std::to_string(i)] = i;
+        }
+        bool all_found = true;
+        for (int i = 0; i < 10000; i += 37) {
+            std::string key = "key_" + std::to_string(i);
+            all_found = all_found && many[std::string_view(key)].Get<int>() == i;
+        }
+        results.expect(all_found && many.Size() == 10000, "Transparent lookups across large object");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Key lookup exception: ") + e.what());
+    }
+}
+
+void testCompileTimeKeys() {
+    std::cout << "\n=== Testing Compile-Time Keys ===\n";
+
+    try {
+        constexpr Json::KeyView price = "price"_key;
+        static_assert(price.HashValue() == Json::KeyView::Hash("price"));
+        results.expect(price.HashValue() == Json::Key("price").HashValue(), "Literal hash matches runtime hash");
+
+        Json order = Json::Parse(R"({"id": 7, "price": 12.5, "qty": 3, "note": "x"})");
+        results.expect(order["price"_key].Get<double>() == 12.5, "Literal key lookup");
+        results.expect(order.Contains("qty"_key) && !order.Contains("missing"_key), "Literal key Contains");
+
+        static constexpr Json::Schema kOrder{"id"_key, "price"_key, "qty"_key, "side"_key};
+        static_assert(kOrder.Size() == 4);
+        static_assert(kOrder.Slot("price"_key) == 1);
+        static_assert(kOrder.Slot("unknown"_key) == kOrder.Size());
+
+        auto fields = kOrder.Bind(order);
+        results.expect(fields["id"_key].Get<int>() == 7 && fields["qty"_key].Get<int>() == 3,
+                       "Schema fields resolve by perfect hash");
+        results.expect(!fields.Contains("side"_key) && fields.Find("note"_key) == nullptr,
+                       "Schema reports missing and unknown keys");
+
+        bool threw = false;
+        try {
+            (void)fields["side"_key];
+        } catch (const JsonException&) {
+            threw = true;
+        }
+        results.expect(threw, "Schema operator[] throws for missing field");
+
+        auto not_object = kOrder.Bind(Json(5));
+        results.expect(not_object.Find("id"_key) == nullptr, "Schema bind on non-object is empty");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Compile-time key exception: ") + e.what());
+    }
+}
+
+void testNonThrowingAccess() {
+    std::cout << "\n=== Testing Non-Throwing Access ===\n";
+
+    try {
+        Json doc = Json::Parse(R"({"name": "widget", "price": 9.5, "tags": ["a"], "active": false})");
+        const Json& const_doc = doc;
+
+        const Json* price = const_doc.Find("price");
+        results.expect(price && price->Get<double>() == 9.5, "Find returns present member");
+        results.expect(const_doc.Find("missing") == nullptr, "Find returns nullptr for missing member");
+        results.expect(Json(3).Find("x") == nullptr, "Find on non-object returns nullptr");
+        results.expect(const_doc.Find("name"_key) != nullptr, "Find with compile-time key");
+
+        Json* tags = doc.Find("tags");
+        tags->PushBack("b");
+        results.expect(doc["tags"].Size() == 2, "Mutable Find edits in place");
+
+        Json shared = doc;
+        shared.Find("name")->Set<std::string>("gadget");
+        results.expect(doc["name"].Get<std::string>() == "widget" && shared["name"].Get<std::string>() == "gadget",
+                       "Mutable Find unshares copy-on-write data");
+
+        Json reader = doc;
+        const bool missed = reader.Find("missing") == nullptr && reader.Find(Json::KeyView("absent")) == nullptr;
+        results.expect(missed && &std::as_const(reader)["price"] == &std::as_const(doc)["price"],
+                       "Mutable Find miss leaves copy-on-write data shared");
+
+        const double* number = price->GetIf<double>();
+        results.expect(number && *number == 9.5, "GetIf<double> on number");
+        results.expect(price->GetIf<std::string>() == nullptr, "GetIf<std::string> on number is nullptr");
+        const bool* active = const_doc.Find("active")->GetIf<bool>();
+        results.expect(active && !*active, "GetIf<bool> on boolean");
+
+        results.expect(!Json("text").TryGet<int>().has_value(), "TryGet<int> on string is empty");
+        results.expect(Json(42).TryGet<long>() == 42L, "TryGet<long> on number");
+        results.expect(Json("x").TryGet<std::string>() == std::string("x"), "TryGet<std::string> on string");
+        results.expect(!Json(nullptr).TryGet<bool>().has_value(), "TryGet<bool> on null is empty");
+
+        Json moved = Json(1);
+        Json target = std::move(moved);
+        results.expect(moved.Find("x") == nullptr && moved.GetIf<double>() == nullptr &&
+                       !moved.TryGet<double>().has_value(), "Moved-from access is non-throwing");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Non-throwing access exception: ") + e.what());
+    }
+}
+
+void testEqualityAndHashing() {
+    std::cout << "\n=== Testing Equality and Hashing ===\n";
+
+    try {
+        Json a = Json::Parse(R"({"id": 1, "tags": ["x", "y"], "meta": {"ok": true, "n": null}})");
+        Json b = Json::Parse(R"({"meta": {"n": null, "ok": true}, "tags": ["x", "y"], "id": 1.0})");
+        results.expect(a == b, "Deep equality ignores member order");
+        results.expect(a.Hash() == b.Hash(), "Equal documents hash alike");
+
+        Json shared = a;
+        results.expect(shared == a && shared.Hash() == a.Hash(), "Shared COW copies compare equal");
+
+        shared["tags"].PushBack("z");
+        results.expect(shared != a, "Mutation of a copy breaks equality");
+        results.expect(shared.Hash() != a.Hash(), "Mutation changes the structural hash");
+
+        shared["tags"].PopBack();
+        results.expect(shared == a && shared.Hash() == a.Hash(), "Reverting mutation restores equality and hash");
+
+        results.expect(Json(0.0) == Json(-0.0) && Json(0.0).Hash() == Json(-0.0).Hash(), "Signed zeros equal");
+        results.expect(Json(1) != Json("1") && Json(nullptr) != Json(false), "Different types are unequal");
+        results.expect(Json::Parse("[1,2]") != Json::Parse("[2,1]"), "Array order matters");
+
+        std::unordered_set<Json> unique;
+        for (int i = 0; i < 100; ++i) {
+            unique.insert(Json::Parse(R"({"k": )" + std::to_string(i % 10) + "}"));
+        }
+        results.expect(unique.size() == 10, "std::hash<Json> deduplicates documents");
+
+        Json base = Json::Object();
+        base["nested"] = Json::Parse(R"({"v": [1, 2, 3]})");
+        Json snapshot = base;
+        size_t before = snapshot.Hash();
+        base["nested"]["v"][0] = 10;
+        results.expect(snapshot.Hash() == before && base.Hash() != before, "Cached hash invalidated on write through COW");
+
+        Json held = Json::Parse(R"({"t": [1]})");
+        Json& t = held["t"];
+        {
+            Json copy = held;
+            (void)copy.Hash();  // Caches a hash on the shared block
+        }
+        t.PushBack(2);  // Written below that block through the held reference
+        Json later = held;
+        Json expected = Json::Parse(R"({"t": [1, 2]})");
+        Json expected_copy = expected;
+        (void)expected.Hash();  // Both sides now carry a cached hash
+        results.expect(later == expected, "Stale cached hash does not reject equality");
+        results.expect(Json::Diff(later, expected).Size() == 0, "Stale cached hash does not produce a diff");
+        Json test_op = Json::Parse(R"([{"op": "test", "path": "", "value": null}])");
+        test_op[0]["value"] = expected;  // Shares the block with the cached hash
+        results.expect(Json::ApplyPatch(later, test_op) == later, "Stale cached hash does not fail a patch test");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Equality and hashing exception: ") + e.what());
+    }
+}
+
+void testJsonPointer() {
+    std::cout << "\n=== Testing JSON Pointer ===\n";
+
+    try {
+        Json doc = Json::Parse(R"({"foo": ["bar", "baz"], "": 0, "a/b": 1, "m~n": 8, "0": "key",
+                                   "deep": {"list": [{"name": "x"}, {"name": "y"}]}})");
+
+        const Json& cdoc = doc;
+        results.expect(cdoc.Find(Json::Pointer("")) == &cdoc, "Empty pointer is the whole document");
+        results.expect(cdoc.At(Json::Pointer("/foo/1")).Get<std::string>() == "baz", "Pointer into an array");
+        results.expect(cdoc.At(Json::Pointer("/")).Get<int>() == 0, "Pointer to the empty key");
+        results.expect(cdoc.At(Json::Pointer("/a~1b")).Get<int>() == 1 && cdoc.At(Json::Pointer("/m~0n")).Get<int>() == 8,
+                       "Pointer escapes ~1 and ~0");
+        results.expect(cdoc.At(Json::Pointer("/0")).Get<std::string>() == "key", "Numeric token used as object key");
+
+        const Json::Pointer name("/deep/list/1/name");
+        results.expect(name.Size() == 4 && name.Segments()[2].index == 1, "Pointer parsed into segments");
+        results.expect(cdoc.At(name).Get<std::string>() == "y", "Nested pointer lookup");
+
+        results.expect(cdoc.Find(Json::Pointer("/foo/2")) == nullptr, "Out of range index is not found");
+        results.expect(cdoc.Find(Json::Pointer("/foo/01")) == nullptr, "Leading zero is not an index");
+        results.expect(cdoc.Find(Json::Pointer("/foo/-")) == nullptr, "'-' does not resolve for lookup");
+        results.expect(cdoc.Find(Json::Pointer("/foo/0/x")) == nullptr, "Path through a scalar is not found");
+
+        Json snapshot = doc;
+        doc.At(name) = "z";
+        results.expect(doc.At(name).Get<std::string>() == "z" && snapshot.At(name).Get<std::string>() == "y",
+                       "Mutable pointer access unshares the path");
+
+        bool threw = false;
+        try {
+            (void)cdoc.At(Json::Pointer("/missing"));
+        } catch (const JsonException&) {
+            threw = true;
+        }
+        results.expect(threw, "At throws for unresolved pointer");
+
+        threw = false;
+        try {
+            Json::Pointer bad("foo");
+        } catch (const JsonException&) {
+            threw = true;
+        }
+        results.expect(threw, "Pointer without leading '/' is rejected");
+
+        threw = false;
+        try {
+            Json::Pointer bad("/a~2");
+        } catch (const JsonException&) {
+            threw = true;
+        }
+        results.expect(threw, "Invalid ~ escape is rejected");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("JSON pointer exception: ") + e.what());
+    }
+}
+
+void testSecondaryIndex() {
+    std::cout << "\n=== Testing Secondary Indexes ===\n";
+
+    try {
+        Json records = Json::Array();
+        for (int i = 0; i < 1000; ++i) {
+            Json record = Json::Object();
+            record["id"] = i * 3;
+            record["name"] = "user" + std::to_string(i);
+            if (i % 100 == 0) record["meta"] = Json::Parse(R"({"team": "core"})");
+            records.PushBack(std::move(record));
+        }
+
+        Json::Index by_id = records.BuildIndex("/id");
+        results.expect(by_id.Find(Json(300)) == std::optional<size_t>(100), "Index finds element position by value");
+        results.expect(!by_id.Find(Json(301)).has_value(), "Index misses absent values");
+        results.expect(!by_id.Find(Json("300")).has_value(), "Index compares values, not text");
+
+        Json::Index by_team = records.BuildIndex(Json::Pointer("/meta/team"));
+        results.expect(by_team.FindAll(Json("core")).size() == 10, "Nested field index with duplicate values");
+
+        Json extra = Json::Object();
+        extra["id"] = 5000;
+        records.PushBack(extra);
+        results.expect(by_id.Find(Json(5000)) == std::optional<size_t>(1000), "PushBack updates the index");
+        records.PopBack();
+        results.expect(!by_id.Find(Json(5000)).has_value(), "PopBack updates the index");
+
+        records[7]["id"] = 7777;
+        results.expect(by_id.Find(Json(7777)) == std::optional<size_t>(7) && !by_id.Find(Json(21)).has_value(),
+                       "In-place changes are picked up on the next lookup");
+
+        Json snapshot = records;
+        snapshot.PushBack(extra);
+        results.expect(!by_id.Find(Json(5000)).has_value(), "Changes to a copy do not reach the index");
+
+        records = Json::Parse(R"([{"id": "a"}, {"id": "b"}, {"id": "a"}])");
+        results.expect(by_id.FindAll(Json("a")) == std::vector<size_t>{0, 2}, "Index follows reassignment");
+
+        // Move assignment: indexes stay with the variable whether or not it had any
+        Json b = Json::Parse(R"([{"id": 1}])");
+        Json::Index ib = b.BuildIndex("/id");
+        Json c = Json::Parse(R"([{"id": 2}])");
+        Json::Index ic = c.BuildIndex("/id");
+        c = std::move(b);
+        Json d = Json::Parse(R"([{"id": 3}])");
+        Json::Index id = d.BuildIndex("/id");
+        Json e = Json::Array();
+        e = std::move(d);
+        results.expect(!ib.Attached() && !id.Attached() && ic.Attached() && ic.Find(Json(1)) == std::optional<size_t>(0),
+                       "Move assignment detaches the moved-from array's indexes");
+
+        Json::Index detached;
+        {
+            Json scoped = Json::Parse(R"([{"id": 1}])");
+            detached = scoped.BuildIndex("/id");
+        }
+        bool threw = false;
+        try {
+            (void)detached.Find(Json(1));
+        } catch (const JsonException&) {
+            threw = true;
+        }
+        results.expect(threw && !detached.Attached(), "Lookups after the array is gone throw");
+
+        threw = false;
+        try {
+            Json object = Json::Object();
+            (void)object.BuildIndex("/id");
+        } catch (const JsonTypeError&) {
+            threw = true;
+        }
+        results.expect(threw, "BuildIndex on non-array throws JsonTypeError");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Secondary index exception: ") + e.what());
+    }
+}
+
+int main() {
+    std::cout << "JSON Library Access Test Suite\n";
+    std::cout << "==============================\n";
+
+    testKeyLookups();
+    testCompileTimeKeys();
+    testNonThrowingAccess();
+    testEqualityAndHashing();
+    testJsonPointer();
+    testSecondaryIndex();
+
+    results.print_summary();
+    return results.failed == 0 ? 0 : 1;
+}
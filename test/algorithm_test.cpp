@@ -0,0 +1,349 @@
+#include "../Json.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <atomic>
+#include <stdexcept>
+#include <functional>
+#include <utility>
+#include <cmath>
+
+// Test result tracking
+struct TestResults {
+    int passed = 0;
+    int failed = 0;
+    std::vector<std::string> failures;
+
+    void expect(bool condition, const std::string& test_name) {
+        if (condition) {
+            passed++;
+            std::cout << "✓ " << test_name << std::endl;
+        } else {
+            failed++;
+            failures.push_back(test_name);
+            std::cout << "✗ " << test_name << std::endl;
+        }
+    }
+
+    void print_summary() {
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        if (!failures.empty()) {
+            std::cout << "Failed tests:" << std::endl;
+            for (const auto& failure : failures) {
+                std::cout << "  - " << failure << std::endl;
+            }
+        }
+    }
+};
+
+TestResults results;
+
+void testParallelAlgorithms() {
+    std::cout << "\n=== Testing Parallel Algorithms ===\n";
+
+    try {
+        const size_t count = 200000;
+        std::vector<double> numbers(count);
+        for (size_t i = 0; i < count; ++i) {
+            numbers[i] = static_cast<double>(i);
+        }
+        Json arr = Json::FromRange(numbers);
+
+        Json snapshot = arr;
+        arr.ParallelForEach([](Json& element) { element = element.Get<double>() * 2; });
+        results.expect(arr[count - 1].Get<double>() == 2.0 * (count - 1), "ParallelForEach mutates every element");
+        results.expect(snapshot[count - 1].Get<double>() == count - 1, "ParallelForEach leaves shared copies untouched");
+
+        std::atomic<size_t> visited{0};
+        std::as_const(arr).ParallelForEach([&](const Json&) { visited.fetch_add(1, std::memory_order_relaxed); });
+        results.expect(visited.load() == count, "Const ParallelForEach visits each element once");
+
+        Json labels = snapshot.ParallelTransform([](const Json& element) {
+            return element.Get<int>() % 2 == 0 ? "even" : "odd";
+        });
+        results.expect(labels.Size() == count && labels[7].Get<std::string>() == "odd" &&
+                       labels[count - 2].Get<std::string>() == "even",
+                       "ParallelTransform builds a new array in order");
+
+        double sum = snapshot.ParallelReduce(0.0, std::plus<>(), [](const Json& e) { return e.Get<double>(); });
+        results.expect(sum == static_cast<double>(count) * (count - 1) / 2, "ParallelReduce sums elements");
+
+        // Non-commutative but associative reduction must keep element order
+        Json letters = Json::Array();
+        for (int i = 0; i < 1000; ++i) letters.PushBack(std::string(1, static_cast<char>('a' + i % 26)));
+        std::string joined = letters.ParallelReduce(std::string(), std::plus<>(),
+                                                    [](const Json& e) { return e.Get<std::string>(); });
+        results.expect(joined.size() == 1000 && joined.compare(0, 27, "abcdefghijklmnopqrstuvwxyza") == 0 &&
+                       joined[999] == static_cast<char>('a' + 999 % 26),
+                       "ParallelReduce preserves element order");
+
+        // Nested parallel calls run inline instead of deadlocking the pool
+        Json matrix = Json::Array();
+        for (int r = 0; r < 64; ++r) matrix.PushBack(Json::FromRange(std::vector<int>(100, r)));
+        matrix.ParallelForEach([](Json& row) { row.ParallelForEach([](Json& cell) { cell = cell.Get<int>() + 1; }); });
+        results.expect(matrix[63][99].Get<int>() == 64 && matrix[0][0].Get<int>() == 1, "Nested ParallelForEach");
+
+        bool threw = false;
+        try {
+            snapshot.ParallelForEach([](const Json& element) {
+                if (element.Get<int>() == 12345) throw std::runtime_error("bad element");
+            });
+        } catch (const std::runtime_error& e) {
+            threw = std::string(e.what()) == "bad element";
+        }
+        results.expect(threw, "ParallelForEach rethrows task exceptions");
+
+        threw = false;
+        try {
+            Json(1).ParallelForEach([](const Json&) {});
+        } catch (const JsonTypeError&) {
+            threw = true;
+        }
+        results.expect(threw, "ParallelForEach on non-array throws JsonTypeError");
+
+        results.expect(Json::Array().ParallelReduce(5, std::plus<>(), [](const Json&) { return 1; }) == 5,
+                       "ParallelReduce on empty array returns init");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Parallel algorithms exception: ") + e.what());
+    }
+}
+
+void testNumericAggregations() {
+    std::cout << "\n=== Testing Numeric Aggregations ===\n";
+
+    try {
+        Json values = Json::FromRange(std::vector<double>{4, -2, 9.5, 0, 3});
+        values.PushBack("not a number");
+        values.PushBack(Json());
+        results.expect(values.Sum() == 14.5, "Sum skips non-numeric elements");
+        results.expect(values.Count() == 5, "Count reports contributing values");
+        results.expect(values.Min() == -2.0 && values.Max() == 9.5, "Min and Max");
+        results.expect(values.Mean() == 2.9, "Mean");
+
+        Json rows = Json::Array();
+        for (int i = 0; i < 1000; ++i) {
+            Json row = Json::Object();
+            row["id"] = i;
+            if (i % 10 != 0) row["price"] = i * 0.5;
+            rows.PushBack(std::move(row));
+        }
+        results.expect(rows.Count("/price") == 900, "Count over a field skips missing values");
+        results.expect(rows.Max("/price") == 499.5 && rows.Min("/price") == 0.5, "Min and Max over a field");
+        results.expect(rows.Sum("/id") == 499500.0, "Sum over a field");
+        results.expect(rows.Mean("/id") == 499.5, "Mean over a field");
+        results.expect(!rows.Mean("/missing").has_value() && rows.Sum("/missing") == 0.0,
+                       "Aggregates over an absent field are empty");
+
+        std::vector<double> ids = rows.ExtractColumn("/id");
+        results.expect(ids.size() == 1000 && ids[0] == 0.0 && ids[999] == 999.0, "ExtractColumn gathers a field in order");
+
+        bool threw = false;
+        try {
+            (void)rows.ExtractColumn("/price");
+        } catch (const JsonException&) {
+            threw = true;
+        }
+        results.expect(threw, "ExtractColumn throws on a missing field");
+
+        Json nested = Json::Parse(R"([{"item": {"price": 2}}, {"item": {"price": 5.5}}, {"item": {}}, {"price": 100}])");
+        static const Json::Pointer kPrice("/item/price");
+        results.expect(nested.Sum("/item/price") == 7.5 && nested.Count(kPrice) == 2,
+                       "Aggregate fields are JSON Pointers into each element");
+        results.expect(nested.Max(kPrice) == 5.5 && nested.Min(kPrice) == 2.0 && nested.Mean(kPrice) == 3.75,
+                       "Min, Max and Mean take a precompiled Pointer");
+        Json pairs = Json::Parse(R"([[1, 10], [2, 20]])");
+        std::vector<double> seconds = pairs.ExtractColumn(Json::Pointer("/1"));
+        results.expect(seconds.size() == 2 && seconds[1] == 20.0, "ExtractColumn follows array indices");
+        results.expect(Json::Parse(R"([{"a/b": 3}])").Sum("/a~1b") == 3.0, "Aggregate field tokens are unescaped");
+
+        threw = false;
+        try {
+            (void)Json::Object().Sum();
+        } catch (const JsonTypeError&) {
+            threw = true;
+        }
+        results.expect(threw, "Aggregation on non-array throws JsonTypeError");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Numeric aggregation exception: ") + e.what());
+    }
+}
+
+void testGroupBy() {
+    std::cout << "\n=== Testing Group-By Aggregation ===\n";
+
+    try {
+        Json orders = Json::Array();
+        const char* regions[] = {"north", "south", "east"};
+        for (int i = 0; i < 3000; ++i) {
+            Json order = Json::Object();
+            order["region"] = regions[i % 3];
+            order["amount"] = static_cast<double>(i);
+            if (i % 2 == 0) order["discount"] = 1.0;
+            orders.PushBack(std::move(order));
+        }
+        Json odd = Json::Object();
+        odd["amount"] = 5.0;
+        orders.PushBack(odd);  // No region: grouped under "null"
+
+        Json groups = Json::GroupBy(orders, "/region", {"amount", "discount"});
+        auto group = [&groups](const Json& key) -> const Json& {
+            for (const Json& g : groups) {
+                if (g.Contains("key") && g["key"] == key) return g;
+            }
+            return groups[groups.Size() - 1];  // The missing-key group comes last here
+        };
+        results.expect(groups.Size() == 4, "GroupBy creates one entry per group");
+        results.expect(groups[0]["key"].Get<std::string>() == "north" && groups[2]["key"].Get<std::string>() == "east",
+                       "GroupBy lists groups in order of first appearance");
+        results.expect(group("north")["count"].Get<int>() == 1000, "GroupBy counts group members");
+        results.expect(group("south")["fields"]["amount"]["sum"].Get<double>() == 1499500.0, "GroupBy sums a field");
+        results.expect(group("east")["fields"]["amount"]["min"].Get<double>() == 2.0 &&
+                       group("east")["fields"]["amount"]["max"].Get<double>() == 2999.0,
+                       "GroupBy tracks min and max");
+        results.expect(group("north")["fields"]["discount"]["count"].Get<int>() == 500, "GroupBy skips missing values");
+        results.expect(!groups[3].Contains("key") && groups[3]["count"].Get<int>() == 1 &&
+                       groups[3]["fields"]["discount"]["min"].IsNull(),
+                       "Missing group key and empty field summary");
+
+        Json by_flag = Json::GroupBy(Json::Parse(R"([{"ok":true},{"ok":false},{"ok":true}])"), "/ok");
+        results.expect(by_flag.Size() == 2 && by_flag[0]["key"] == Json(true) && by_flag[0]["count"].Get<int>() == 2,
+                       "Non-string group keys keep their JSON value");
+
+        Json tagged = Json::GroupBy(Json::Parse(R"([{"k":"null"},{"k":null},{},{"k":5},{"k":"5"},{"k":5.0}])"), "/k");
+        results.expect(tagged.Size() == 5 && tagged[0]["key"] == Json("null") && tagged[1]["key"].IsNull() &&
+                       !tagged[2].Contains("key") && tagged[3]["count"].Get<int>() == 2,
+                       "Group keys are compared by type and value");
+
+        Json named = Json::GroupBy(Json::Parse(R"([{"g":1,"count":7},{"g":1,"count":3}])"), "/g", {"count"});
+        results.expect(named[0]["count"].Get<int>() == 2 && named[0]["fields"]["count"]["sum"].Get<double>() == 10.0,
+                       "A value field named count does not replace the group count");
+
+        Json nested = Json::GroupBy(Json::Parse(R"([{"a":{"b":"x"}},{"a":{"b":"y"}},{"a":{"b":"x"}}])"),
+                                    Json::Pointer("/a/b"));
+        results.expect(nested.Size() == 2 && nested[0]["count"].Get<int>() == 2, "GroupBy by a nested key path");
+
+        bool threw = false;
+        try {
+            (void)Json::GroupBy(Json::Parse("[1, 2]"), "/k");
+        } catch (const JsonTypeError&) {
+            threw = true;
+        }
+        results.expect(threw, "GroupBy over non-object elements throws JsonTypeError");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Group-by exception: ") + e.what());
+    }
+}
+
+void testSortAndUnique() {
+    std::cout << "\n=== Testing Key-Extracting Sort and Dedupe ===\n";
+
+    try {
+        Json people = Json::Parse(R"([
+            {"name": "dana", "age": 41},
+            {"name": "ari", "age": 29},
+            {"name": "cy"},
+            {"name": "bo", "age": 29},
+            {"name": "eve", "age": null}
+        ])");
+        Json original = people;
+
+        auto names = [](const Json& arr) {
+            std::string out;
+            for (const Json& person : arr) out += person["name"].Get<std::string>() + " ";
+            return out;
+        };
+
+        people.SortBy("/age");
+        results.expect(names(people) == "cy eve ari bo dana ", "SortBy orders missing, null, then numbers, stably");
+        people.SortBy("/age", Json::SortOrder::Descending);
+        results.expect(names(people) == "dana ari bo eve cy ", "SortBy descending keeps ties in order");
+        people.SortBy(Json::Pointer("/name"));
+        results.expect(names(people) == "ari bo cy dana eve ", "SortBy string keys");
+        results.expect(names(original) == "dana ari cy bo eve ", "SortBy leaves shared copies untouched");
+
+        // Sorting and deduping move element handles; the elements stay shared
+        Json source = Json::Parse(R"([{"k": 3}, {"k": 1}, {"k": 2}, {"k": 1}])");
+        Json sorted = source;
+        sorted.SortBy("/k");
+        const bool sort_shared = &std::as_const(sorted)[0]["k"] == &std::as_const(source)[1]["k"] &&
+                                 &std::as_const(sorted)[3]["k"] == &std::as_const(source)[0]["k"];
+        Json deduped = source;
+        deduped.UniqueBy("/k");
+        const bool unique_shared = deduped.Size() == 3 && &std::as_const(deduped)[2]["k"] == &std::as_const(source)[2]["k"];
+        results.expect(sort_shared && unique_shared, "SortBy and UniqueBy keep elements shared with copies");
+
+        Json mixed = Json::Parse(R"(["b", 3, null, true, [1], "a", {"k": 1}, 1, false])");
+        mixed.SortBy("");
+        results.expect(mixed.ToString() == R"([null,false,true,1,3,"a","b",[1],{"k":1}])",
+                       "SortBy on whole elements ranks types");
+
+        // Large enough to take the chunked sort and merge path
+        const int count = 100000;
+        Json rows = Json::Array();
+        rows.Reserve(count);
+        for (int i = 0; i < count; ++i) {
+            Json row = Json::Object();
+            row["key"] = (i * 7919) % 1000;
+            row["seq"] = i;
+            rows.PushBack(std::move(row));
+        }
+        rows.SortBy("/key");
+        bool ordered = true;
+        for (int i = 1; i < count && ordered; ++i) {
+            const int prev_key = rows[i - 1]["key"].Get<int>();
+            const int key = rows[i]["key"].Get<int>();
+            ordered = prev_key < key || (prev_key == key && rows[i - 1]["seq"].Get<int>() < rows[i]["seq"].Get<int>());
+        }
+        results.expect(ordered && rows.Size() == static_cast<size_t>(count), "Large SortBy is ordered and stable");
+
+        results.expect(rows.UniqueBy("/key") == static_cast<size_t>(count - 1000) && rows.Size() == 1000,
+                       "UniqueBy removes repeated keys");
+        results.expect(rows[0]["seq"].Get<int>() == 0 && rows[999]["key"].Get<int>() == 999,
+                       "UniqueBy keeps the first element of each key");
+
+        // NaN keys must not break the ordering of the other numbers
+        Json readings = Json::Array();
+        for (int i = 0; i < 200; ++i) {
+            Json reading = Json::Object();
+            reading["v"] = i % 3 == 0 ? std::nan("") : static_cast<double>((i * 37) % 101);
+            readings.PushBack(std::move(reading));
+        }
+        readings.SortBy("/v");
+        bool numbers_ordered = true;
+        for (int i = 1; i < 133; ++i) {
+            numbers_ordered = numbers_ordered && readings[i - 1]["v"].Get<double>() <= readings[i]["v"].Get<double>();
+        }
+        bool nan_last = true;
+        for (int i = 133; i < 200; ++i) nan_last = nan_last && std::isnan(readings[i]["v"].Get<double>());
+        results.expect(numbers_ordered && nan_last, "SortBy orders NaN keys after other numbers");
+
+        Json tags = Json::Parse(R"([{"t": 1}, {"t": 1.0}, {}, {"t": "1"}, {}, {"t": [1]}, {"t": [1]}])");
+        results.expect(tags.UniqueBy("/t") == 3 && tags.ToString() == R"([{"t":1},{},{"t":"1"},{"t":[1]}])",
+                       "UniqueBy compares values structurally");
+
+        bool threw = false;
+        try {
+            Json(1).SortBy("/x");
+        } catch (const JsonTypeError&) {
+            threw = true;
+        }
+        results.expect(threw, "SortBy on non-array throws JsonTypeError");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Sort and dedupe exception: ") + e.what());
+    }
+}
+
+int main() {
+    std::cout << "JSON Library Algorithm Test Suite\n";
+    std::cout << "=================================\n";
+
+    testParallelAlgorithms();
+    testNumericAggregations();
+    testGroupBy();
+    testSortAndUnique();
+
+    results.print_summary();
+    return results.failed == 0 ? 0 : 1;
+}
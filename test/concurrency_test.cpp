@@ -0,0 +1,203 @@
+#include "../Json.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <utility>
+
+// Test result tracking
+struct TestResults {
+    int passed = 0;
+    int failed = 0;
+    std::vector<std::string> failures;
+
+    void expect(bool condition, const std::string& test_name) {
+        if (condition) {
+            passed++;
+            std::cout << "✓ " << test_name << std::endl;
+        } else {
+            failed++;
+            failures.push_back(test_name);
+            std::cout << "✗ " << test_name << std::endl;
+        }
+    }
+
+    void print_summary() {
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        if (!failures.empty()) {
+            std::cout << "Failed tests:" << std::endl;
+            for (const auto& failure : failures) {
+                std::cout << "  - " << failure << std::endl;
+            }
+        }
+    }
+};
+
+TestResults results;
+
+void testAtomicRef() {
+    std::cout << "\n=== Testing Atomically Published Documents ===\n";
+
+    try {
+        Json::AtomicRef config(Json::Parse(R"({"version": 0, "mirror": 0, "routes": {"default": "a"}})"));
+        Json::AtomicRef::Snapshot first = config.Load();
+
+        // Readers check that every snapshot is internally consistent and that
+        // versions never go backwards, while writers publish new ones
+        const int kUpdates = 2000;
+        std::atomic<bool> done{false};
+        std::atomic<int> torn{0};
+        std::atomic<int> regressions{0};
+        std::vector<std::thread> readers;
+        for (int r = 0; r < 4; ++r) {
+            readers.emplace_back([&] {
+                int last = 0;
+                while (!done.load(std::memory_order_acquire)) {
+                    Json::AtomicRef::Snapshot snapshot = config.Load();
+                    const Json& doc = *snapshot;
+                    const int version = doc["version"].Get<int>();
+                    if (doc["mirror"].Get<int>() != version) torn.fetch_add(1);
+                    if (version < last) regressions.fetch_add(1);
+                    if (doc["routes"]["default"].Get<std::string>().empty()) torn.fetch_add(1);
+                    last = version;
+                }
+            });
+        }
+
+        std::vector<std::thread> writers;
+        for (int w = 0; w < 2; ++w) {
+            writers.emplace_back([&] {
+                for (int i = 0; i < kUpdates / 2; ++i) {
+                    config.Update([](Json& next) {
+                        const int version = next["version"].Get<int>() + 1;
+                        next["version"] = version;
+                        next["mirror"] = version;
+                    });
+                }
+            });
+        }
+        for (auto& writer : writers) writer.join();
+        done.store(true, std::memory_order_release);
+        for (auto& reader : readers) reader.join();
+
+        Json::AtomicRef::Snapshot last = config.Load();
+        results.expect((*last)["version"].Get<int>() == kUpdates, "Concurrent updates are not lost");
+        results.expect(torn.load() == 0, "Readers never see a partially updated document");
+        results.expect(regressions.load() == 0, "Readers never see an older version after a newer one");
+        results.expect((*first)["version"].Get<int>() == 0 && first.use_count() == 1,
+                       "Old snapshots stay valid until released");
+
+        Json::AtomicRef::Snapshot expected = config.Load();
+        bool swapped = config.CompareExchange(expected, Json::Parse(R"({"version": -1})"));
+        Json::AtomicRef::Snapshot stale = first;
+        bool rejected = !config.CompareExchange(stale, Json());
+        results.expect(swapped && rejected && (*stale)["version"].Get<int>() == -1,
+                       "CompareExchange publishes only over the expected version");
+
+        Json::AtomicRef::Snapshot previous = config.Exchange(Json::Parse(R"({"version": 7})"));
+        config.Store(Json::Parse(R"({"version": 8})"));
+        results.expect((*previous)["version"].Get<int>() == -1 && (*config.Load())["version"].Get<int>() == 8,
+                       "Exchange and Store publish new versions");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("AtomicRef exception: ") + e.what());
+    }
+}
+
+void testConcurrentReads() {
+    std::cout << "\n=== Testing Concurrent Reads of a Shared Document ===\n";
+
+    try {
+        Json doc = Json::Object();
+        for (int i = 0; i < 64; ++i) {
+            doc["key" + std::to_string(i)] = i;
+        }
+        doc["nested"] = Json::Parse(R"({"list": [1, 2, 3], "name": "shared"})");
+        const Json& shared = doc;
+
+        // Const lookups from many threads must not write to the shared document
+        const unsigned num_threads = 8;
+        std::atomic<int> mismatches{0};
+        std::vector<std::thread> readers;
+        for (unsigned t = 0; t < num_threads; ++t) {
+            readers.emplace_back([&shared, &mismatches, t] {
+                for (int round = 0; round < 2000; ++round) {
+                    const int i = static_cast<int>((round + t) % 64);
+                    const std::string key = "key" + std::to_string(i);
+                    if (shared[key].Get<int>() != i || !shared.Contains(key) || shared.Contains("missing")) {
+                        mismatches.fetch_add(1);
+                    }
+                    if (shared["nested"]["list"].Size() != 3 || shared["nested"]["name"].Get<std::string>() != "shared") {
+                        mismatches.fetch_add(1);
+                    }
+                }
+            });
+        }
+        for (auto& reader : readers) reader.join();
+        results.expect(mismatches.load() == 0, "Concurrent const lookups see consistent values");
+
+        // Const bulk conversion of a value whose storage is shared with another document
+        Json base = Json::Parse(R"({"a": [1, 2, 3, 4]})");
+        Json tmp = base;
+        tmp["b"] = 1;  // Unshares tmp's object; tmp["a"] still shares base["a"]
+        const Json& column = std::as_const(tmp)["a"];
+        std::atomic<int> wrong_copies{0};
+        std::vector<std::thread> copiers;
+        for (int t = 0; t < 4; ++t) {
+            copiers.emplace_back([&column, &wrong_copies] {
+                for (int round = 0; round < 500; ++round) {
+                    std::vector<int> values;
+                    column.CopyTo(values);
+                    if (values != std::vector<int>{1, 2, 3, 4}) wrong_copies.fetch_add(1);
+                }
+            });
+        }
+        for (auto& copier : copiers) copier.join();
+        results.expect(wrong_copies.load() == 0 && &column[0] == &std::as_const(base)["a"][0],
+                       "Concurrent const CopyTo reads shared storage without unsharing it");
+
+        // Sampling is per thread and off unless requested
+        Json::AccessStats before = Json::ThreadAccessStats();
+        (void)shared.Contains("key1");
+        results.expect(before.period == 0 && Json::ThreadAccessStats().lookups == 0, "Access sampling is off by default");
+
+        Json::SampleObjectAccess(4);
+        for (int i = 0; i < 100; ++i) {
+            (void)shared.Contains(i % 2 == 0 ? "key1" : "absent");
+        }
+        Json::AccessStats sampled = Json::ThreadAccessStats();
+        results.expect(sampled.period == 4 && sampled.lookups == 25 && sampled.EstimatedLookups() == 100,
+                       "Sampling records one lookup in every period");
+        results.expect(sampled.misses == 25, "Sampled misses are counted with their lookups");
+
+        Json::AccessStats other;
+        std::thread([&other, &shared] {
+            (void)shared.Contains("key2");
+            other = Json::ThreadAccessStats();
+        }).join();
+        results.expect(other.period == 0 && other.lookups == 0, "Sampling settings and counters are per thread");
+
+        Json::SampleObjectAccess(1);
+        Json::ResetThreadAccessStats();
+        (void)shared.Contains("absent");
+        (void)shared["key3"];
+        sampled = Json::ThreadAccessStats();
+        results.expect(sampled.lookups == 2 && sampled.misses == 1, "Every lookup is recorded with period 1");
+        Json::SampleObjectAccess(0);
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Concurrent read exception: ") + e.what());
+    }
+}
+
+int main() {
+    std::cout << "JSON Library Concurrency Test Suite\n";
+    std::cout << "===================================\n";
+
+    testAtomicRef();
+    testConcurrentReads();
+
+    results.print_summary();
+    return results.failed == 0 ? 0 : 1;
+}
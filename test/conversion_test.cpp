@@ -0,0 +1,212 @@
+#include "../Json.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <list>
+#include <map>
+#include <unordered_map>
+#include <string>
+#include <optional>
+#include <utility>
+
+struct Address {
+    std::string city;
+    int zip;
+};
+
+struct Person {
+    std::string name;
+    double height;
+    bool active;
+    std::optional<std::string> email;
+    std::vector<int> scores;
+    Address address;
+};
+
+template<>
+struct JsonFields<Address> {
+    static constexpr auto value = std::make_tuple(JsonField{"city", &Address::city},
+                                                  JsonField{"zip", &Address::zip});
+};
+
+template<>
+struct JsonFields<Person> {
+    static constexpr auto value = std::make_tuple(JsonField{"name", &Person::name},
+                                                  JsonField{"height", &Person::height},
+                                                  JsonField{"active", &Person::active},
+                                                  JsonField{"email", &Person::email},
+                                                  JsonField{"scores", &Person::scores},
+                                                  JsonField{"address", &Person::address});
+};
+
+// Test result tracking
+struct TestResults {
+    int passed = 0;
+    int failed = 0;
+    std::vector<std::string> failures;
+
+    void expect(bool condition, const std::string& test_name) {
+        if (condition) {
+            passed++;
+            std::cout << "✓ " << test_name << std::endl;
+        } else {
+            failed++;
+            failures.push_back(test_name);
+            std::cout << "✗ " << test_name << std::endl;
+        }
+    }
+
+    void print_summary() {
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        if (!failures.empty()) {
+            std::cout << "Failed tests:" << std::endl;
+            for (const auto& failure : failures) {
+                std::cout << "  - " << failure << std::endl;
+            }
+        }
+    }
+};
+
+TestResults results;
+
+void testBulkConversion() {
+    std::cout << "\n=== Testing Bulk Conversion ===\n";
+
+    try {
+        std::vector<double> numbers(100000);
+        for (size_t i = 0; i < numbers.size(); ++i) {
+            numbers[i] = static_cast<double>(i) * 0.5;
+        }
+
+        Json arr = Json::FromRange(numbers);
+        results.expect(arr.IsArray() && arr.Size() == numbers.size(), "FromRange vector<double> size");
+        results.expect(arr[1234].Get<double>() == 617.0, "FromRange vector<double> element");
+
+        std::vector<double> back;
+        arr.CopyTo(back);
+        results.expect(back == numbers, "CopyTo vector<double> round trip");
+        results.expect(arr.As<std::vector<int>>()[10] == 5, "As<vector<int>> converts numbers");
+
+        std::vector<std::string> words = {"alpha", "beta", "gamma"};
+        Json word_arr = Json::FromRange(words);
+        results.expect(word_arr.ToString() == R"(["alpha","beta","gamma"])", "FromRange vector<string>");
+        results.expect(word_arr.As<std::vector<std::string>>() == words, "As<vector<string>> round trip");
+
+        std::list<int> linked = {3, 1, 2};
+        Json from_list = Json::FromRange(linked);
+        results.expect(from_list.ToString() == "[3,1,2]", "FromRange non-contiguous range");
+
+        std::vector<std::vector<int>> nested = {{1, 2}, {3}};
+        results.expect(Json::FromRange(nested).ToString() == "[[1,2],[3]]", "FromRange nested ranges");
+
+        std::map<std::string, double> prices = {{"apple", 1.5}, {"pear", 2.0}};
+        Json price_obj = Json::FromRange(prices);
+        results.expect(price_obj.IsObject() && price_obj["pear"].Get<double>() == 2.0, "FromRange map becomes object");
+        results.expect(price_obj.As<std::map<std::string, double>>() == prices, "As<map> round trip");
+
+        auto unordered = price_obj.As<std::unordered_map<std::string, double>>();
+        results.expect(unordered.size() == 2 && unordered["apple"] == 1.5, "As<unordered_map> conversion");
+
+        std::vector<Json> handles;
+        arr.CopyTo(handles);
+        results.expect(handles.size() == numbers.size() && handles[2].Get<double>() == 1.0, "CopyTo vector<Json>");
+
+        // Reading through CopyTo/As must not unshare copy-on-write storage
+        Json shared_arr = arr;
+        std::vector<double> copied;
+        std::as_const(shared_arr).CopyTo(copied);
+        Json shared_obj = price_obj;
+        (void)std::as_const(shared_obj).As<std::map<std::string, double>>();
+        (void)std::as_const(shared_obj).As<std::unordered_map<std::string, double>>();
+        results.expect(&std::as_const(shared_arr)[0] == &std::as_const(arr)[0] &&
+                       &std::as_const(shared_obj)["pear"] == &std::as_const(price_obj)["pear"],
+                       "CopyTo and As leave shared storage shared");
+
+        Json mixed = Json::Array();
+        mixed.PushBack(1);
+        mixed.PushBack("two");
+        bool threw = false;
+        try {
+            (void)mixed.As<std::vector<double>>();
+        } catch (const JsonTypeError&) {
+            threw = true;
+        }
+        results.expect(threw, "CopyTo throws JsonTypeError on mismatched element");
+
+        threw = false;
+        try {
+            std::vector<double> out;
+            Json(42).CopyTo(out);
+        } catch (const JsonTypeError&) {
+            threw = true;
+        }
+        results.expect(threw, "CopyTo on non-array throws JsonTypeError");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Bulk conversion exception: ") + e.what());
+    }
+}
+
+void testDirectEncoding() {
+    std::cout << "\n=== Testing Direct Struct Encoding ===\n";
+
+    try {
+        Person person{"Ann \"A\"\n", 1.75, true, std::nullopt, {90, 85}, {"Oslo", 150}};
+        std::string encoded = Json::Encode(person);
+        results.expect(encoded == R"({"name":"Ann \"A\"\n","height":1.75,"active":true,"email":null,)"
+                                  R"("scores":[90,85],"address":{"city":"Oslo","zip":150}})",
+                       "Encode writes described struct");
+
+        Json parsed = Json::Parse(encoded);
+        results.expect(parsed["name"].Get<std::string>() == person.name && parsed["email"].IsNull(),
+                       "Encoded text parses back");
+        results.expect(parsed["address"]["city"].Get<std::string>() == "Oslo", "Encoded nested struct");
+
+        Json dom = Json::Object();
+        dom["height"] = 0.1;
+        std::string dom_text = dom.ToString();
+        std::string writer_text;
+        JsonWriter writer(writer_text);
+        writer.BeginObject();
+        writer.Key("height");
+        writer.Number(0.1);
+        writer.EndObject();
+        results.expect(writer_text == dom_text, "JsonWriter number formatting matches ToString");
+
+        person.email = "ann@example.com";
+        std::string buffer;
+        for (int i = 0; i < 3; ++i) {
+            Json::Encode(person, buffer);
+            buffer += '\n';
+        }
+        results.expect(buffer.find("ann@example.com") != std::string::npos &&
+                       std::count(buffer.begin(), buffer.end(), '\n') == 3,
+                       "Encode appends records to a reused buffer");
+
+        std::string control;
+        JsonWriter(control).String(std::string("a\x01" "b", 3));
+        results.expect(control == R"("a\u0001b")", "JsonWriter escapes control characters");
+
+        std::string with_dom;
+        JsonWriter mixed(with_dom);
+        mixed.BeginArray();
+        mixed.Value(Json::Parse(R"({"k":[1,2]})"));
+        mixed.Write(std::map<std::string, int>{{"n", 1}});
+        mixed.EndArray();
+        results.expect(with_dom == R"([{"k":[1,2]},{"n":1}])", "JsonWriter mixes DOM values and containers");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Direct encoding exception: ") + e.what());
+    }
+}
+
+int main() {
+    std::cout << "JSON Library Conversion Test Suite\n";
+    std::cout << "==================================\n";
+
+    testBulkConversion();
+    testDirectEncoding();
+
+    results.print_summary();
+    return results.failed == 0 ? 0 : 1;
+}
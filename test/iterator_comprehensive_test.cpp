@@ -5,6 +5,12 @@
 #include <algorithm>
 #include <numeric>
 #include <variant>
+#include <iterator>
+#include <utility>
+#include <string_view>
+#include <type_traits>
+#include <ranges>
+#include <span>
 
 void test_array_iterators() {
     std::cout << "\n=== Testing Array Iterators ===\n";
@@ -159,7 +165,7 @@ void test_object_iterators() {
     count = 0;
     std::vector<std::string> found_keys;
     for (const auto& item : multi_obj.ObjectItems()) {
-        found_keys.push_back(item.key);
+        found_keys.emplace_back(item.key);
         count++;
     }
     assert(count == 4);
@@ -505,6 +511,171 @@ void test_algorithm_compatibility() {
     std::cout << "✓ Object iteration with algorithms" << std::endl;
 }
 
+void test_object_iterator_handles() {
+    std::cout << "\n=== Testing Object Iterator Handles ===\n";
+
+    static_assert(std::is_trivially_copyable_v<Json::ObjectIterator>);
+    static_assert(std::is_trivially_copyable_v<Json::ConstObjectIterator>);
+    static_assert(std::forward_iterator<Json::ObjectIterator>);
+    static_assert(std::is_same_v<decltype(Json::KeyValue::key), std::string_view>);
+
+    auto obj = Json::Object();
+    obj["alpha"] = 1;
+    obj["beta"] = 2;
+
+    auto it = obj.object_begin();
+    std::string_view first_key = it->key;
+    assert(first_key == "alpha" || first_key == "beta");
+    assert(it->value().Get<int>() == obj[first_key].Get<int>());
+    std::cout << "✓ Arrow access to key and value" << std::endl;
+
+    // Keys view the stored member names, so they stay valid across iteration
+    std::vector<std::string_view> seen;
+    for (auto [key, value] : obj.ObjectItems()) {
+        value = value.Get<int>() * 10;
+        seen.push_back(key);
+    }
+    assert(seen.size() == 2 && obj["alpha"].Get<int>() == 10 && obj["beta"].Get<int>() == 20);
+    assert(std::find(seen.begin(), seen.end(), "beta") != seen.end());
+    std::cout << "✓ Structured bindings with string_view keys" << std::endl;
+
+    auto copy = it;
+    ++it;
+    assert(copy != it && copy->key == first_key);
+    std::cout << "✓ Iterator copies are independent" << std::endl;
+
+    Json scalar = "text";
+    assert(scalar.object_begin() == scalar.object_end());
+    std::cout << "✓ Non-objects iterate as empty ranges" << std::endl;
+}
+
+void test_member_views() {
+    std::cout << "\n=== Testing Key and Value Views ===\n";
+
+    auto obj = Json::Object();
+    obj["x"] = 1;
+    obj["y"] = 2;
+    obj["z"] = 3;
+
+    std::vector<std::string_view> keys(obj.KeysView().begin(), obj.KeysView().end());
+    std::sort(keys.begin(), keys.end());
+    assert(obj.KeysView().size() == 3);
+    assert((keys == std::vector<std::string_view>{"x", "y", "z"}));
+    std::cout << "✓ KeysView yields string_view keys" << std::endl;
+
+    int sum = 0;
+    for (const Json& value : std::as_const(obj).Values()) {
+        sum += value.Get<int>();
+    }
+    assert(sum == 6);
+    std::cout << "✓ Const Values view" << std::endl;
+
+    Json snapshot = obj;
+    for (Json& value : obj.Values()) {
+        value = value.Get<int>() + 10;
+    }
+    assert(obj["y"].Get<int>() == 12 && snapshot["y"].Get<int>() == 2);
+    std::cout << "✓ Mutable Values view unshares copies" << std::endl;
+
+    Json array = Json::Array();
+    array.PushBack(1);
+    assert(array.KeysView().empty() && array.Values().begin() == array.Values().end());
+    std::cout << "✓ Views over non-objects are empty" << std::endl;
+}
+
+void test_ranges_integration() {
+    std::cout << "\n=== Testing std::ranges Integration ===\n";
+
+    static_assert(std::ranges::random_access_range<Json&>);
+    static_assert(std::ranges::contiguous_range<const Json&>);
+    static_assert(std::ranges::borrowed_range<std::span<const Json>>);
+    static_assert(std::ranges::view<Json::ConstObjectRange>);
+    static_assert(std::ranges::forward_range<Json::ObjectRange>);
+    static_assert(std::ranges::borrowed_range<Json::KeyRange>);
+    static_assert(std::ranges::borrowed_range<Json::ValueRange>);
+
+    auto arr = Json::Array();
+    for (int i = 1; i <= 10; ++i) {
+        arr.PushBack(i);
+    }
+
+    auto squares_of_evens = arr
+        | std::views::filter([](const Json& v) { return v.Get<int>() % 2 == 0; })
+        | std::views::transform([](const Json& v) { return v.Get<int>() * v.Get<int>(); });
+    std::vector<int> collected(squares_of_evens.begin(), squares_of_evens.end());
+    assert((collected == std::vector<int>{4, 16, 36, 64, 100}));
+    std::cout << "✓ Lazy filter/transform pipeline over an array" << std::endl;
+
+    std::span<const Json> elements = std::as_const(arr).Elements();
+    assert(elements.size() == 10 && elements[9].Get<int>() == 10);
+    assert(Json(1.5).Elements().empty());
+    std::cout << "✓ Elements() span over array storage" << std::endl;
+
+    auto obj = Json::Object();
+    obj["short"] = "ab";
+    obj["long"] = "abcdef";
+    obj["mid"] = "abcd";
+
+    // Borrowed iterators outlive the view temporaries they came from
+    auto found = std::ranges::find_if(std::as_const(obj).ObjectItems(),
+                                      [](const Json::ConstKeyValue& item) { return item.key == "mid"; });
+    assert(found != std::as_const(obj).ObjectItems().end() && (*found).value().Get<std::string>() == "abcd");
+
+    auto long_keys = obj.KeysView()
+        | std::views::filter([&obj](std::string_view key) { return obj[key].Get<std::string>().size() > 3; });
+    assert(std::ranges::distance(long_keys) == 2);
+    std::cout << "✓ Object views compose with std::views" << std::endl;
+}
+
+void test_random_access_iterators() {
+    std::cout << "\n=== Testing Random-Access Array Iterators ===\n";
+
+    static_assert(std::contiguous_iterator<Json::Iterator>);
+    static_assert(std::contiguous_iterator<Json::ConstIterator>);
+
+    auto arr = Json::Array();
+    for (int v : {5, 3, 9, 1, 7}) {
+        arr.PushBack(v);
+    }
+
+    auto it = arr.begin();
+    assert(arr.end() - it == 5);
+    assert(it[2].Get<int>() == 9);
+    assert((it + 4)->Get<int>() == 7);
+    assert(it < arr.end() && arr.end() > it);
+    std::cout << "✓ Iterator arithmetic and subscript" << std::endl;
+
+    // Sorting through a copy must unshare it and leave the original untouched
+    Json sorted = arr;
+    std::sort(sorted.begin(), sorted.end(), [](const Json& a, const Json& b) {
+        return a.Get<int>() < b.Get<int>();
+    });
+    assert(sorted.ToString() == "[1,3,5,7,9]");
+    assert(arr.ToString() == "[5,3,9,1,7]");
+    std::cout << "✓ std::sort on copy-on-write array" << std::endl;
+
+    const Json& const_sorted = sorted;
+    auto pos = std::lower_bound(const_sorted.begin(), const_sorted.end(), 6,
+                                [](const Json& item, int value) { return item.Get<int>() < value; });
+    assert(pos - const_sorted.begin() == 3 && pos->Get<int>() == 7);
+    std::cout << "✓ std::lower_bound on const iterators" << std::endl;
+
+    const Json* first = std::to_address(const_sorted.begin());
+    double total = 0;
+    for (size_t i = 0; i < const_sorted.Size(); ++i) {
+        total += first[i].Get<double>();
+    }
+    assert(total == 25);
+    std::cout << "✓ Contiguous storage access" << std::endl;
+
+    Json scalar = 42;
+    assert(scalar.begin() == scalar.end());
+    Json object = Json::Object();
+    object["a"] = 1;
+    assert(std::as_const(object).begin() == std::as_const(object).end());
+    std::cout << "✓ Non-arrays iterate as empty ranges" << std::endl;
+}
+
 int main() {
     try {
         std::cout << "JSON Library Iterator Comprehensive Test Suite\n";
@@ -515,6 +686,10 @@ int main() {
         test_nested_iteration();
         test_iterator_edge_cases();
         test_algorithm_compatibility();
+        test_random_access_iterators();
+        test_object_iterator_handles();
+        test_member_views();
+        test_ranges_integration();
         
         std::cout << "\n🔄 All iterator tests completed successfully!\n";
         std::cout << "This suite validates that iterators work correctly in all scenarios\n";
@@ -0,0 +1,346 @@
+#include "../Json.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <utility>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+// Counts heap allocations, to check that draining a tracker copies nothing
+static std::atomic<size_t> allocations{0};
+
+void* operator new(std::size_t size) {
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+// Test result tracking
+struct TestResults {
+    int passed = 0;
+    int failed = 0;
+    std::vector<std::string> failures;
+
+    void expect(bool condition, const std::string& test_name) {
+        if (condition) {
+            passed++;
+            std::cout << "✓ " << test_name << std::endl;
+        } else {
+            failed++;
+            failures.push_back(test_name);
+            std::cout << "✗ " << test_name << std::endl;
+        }
+    }
+
+    void print_summary() {
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        if (!failures.empty()) {
+            std::cout << "Failed tests:" << std::endl;
+            for (const auto& failure : failures) {
+                std::cout << "  - " << failure << std::endl;
+            }
+        }
+    }
+};
+
+TestResults results;
+
+// Storage address of an array, to tell shared values from copied ones
+const Json* ArrayData(const Json& array) {
+    return array.Elements().data();
+}
+
+void testJsonPatch() {
+    std::cout << "\n=== Testing JSON Patch ===\n";
+
+    try {
+        const Json doc = Json::Parse(R"({
+            "config": {"name": "edge", "ports": [80, 443], "tags": {"env": "prod"}},
+            "big": [1, 2, 3, 4, 5, 6, 7, 8]
+        })");
+
+        Json patched = Json::ApplyPatch(doc, Json::Parse(R"([
+            {"op": "test", "path": "/config/name", "value": "edge"},
+            {"op": "add", "path": "/config/ports/1", "value": 8080},
+            {"op": "add", "path": "/config/ports/-", "value": 9090},
+            {"op": "replace", "path": "/config/name", "value": "core"},
+            {"op": "remove", "path": "/config/tags/env"},
+            {"op": "add", "path": "/config/tags/a~1b", "value": true},
+            {"op": "copy", "from": "/config/ports/0", "path": "/first"},
+            {"op": "move", "from": "/first", "path": "/config/primary"}
+        ])"));
+        results.expect(patched["config"] == Json::Parse(
+                           R"({"name":"core","ports":[80,8080,443,9090],"tags":{"a/b":true},"primary":80})"),
+                       "Patch operations applied in order");
+        results.expect(!patched.Contains("first"), "Move removes the source");
+        results.expect(doc["config"]["name"].Get<std::string>() == "edge" && doc["config"]["ports"].Size() == 2,
+                       "Original document is unchanged");
+        results.expect(ArrayData(patched["big"]) == ArrayData(doc["big"]), "Untouched subtrees stay shared");
+        results.expect(ArrayData(patched["config"]["ports"]) != ArrayData(doc["config"]["ports"]),
+                       "Modified containers are copied");
+
+        Json root = Json::ApplyPatch(doc, Json::Parse(R"([{"op": "replace", "path": "", "value": [1]}])"));
+        results.expect(root.ToString() == "[1]", "Replacing the root");
+
+        std::string message;
+        try {
+            (void)Json::ApplyPatch(doc, Json::Parse(R"([
+                {"op": "replace", "path": "/config/name", "value": "changed"},
+                {"op": "test", "path": "/big/0", "value": 2}
+            ])"));
+        } catch (const JsonException& e) {
+            message = e.what();
+        }
+        results.expect(message.find("operation 1") != std::string::npos && doc["config"]["name"].Get<std::string>() == "edge",
+                       "Failing test aborts the whole patch");
+
+        auto fails = [&](const char* patch) {
+            try {
+                (void)Json::ApplyPatch(doc, Json::Parse(patch));
+            } catch (const JsonException&) {
+                return true;
+            }
+            return false;
+        };
+        results.expect(fails(R"([{"op": "remove", "path": "/missing"}])"), "Removing a missing member fails");
+        results.expect(fails(R"([{"op": "add", "path": "/big/9", "value": 0}])"), "Adding past the array end fails");
+        results.expect(fails(R"([{"op": "add", "path": "/nope/x", "value": 0}])"), "Adding under a missing parent fails");
+        results.expect(fails(R"([{"op": "move", "from": "/config", "path": "/config/inner"}])"),
+                       "Moving a value into itself fails");
+        results.expect(fails(R"([{"op": "frobnicate", "path": "/big"}])") && fails(R"([{"path": "/big"}])"),
+                       "Unknown or missing op fails");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("JSON Patch exception: ") + e.what());
+    }
+}
+
+void testMergePatch() {
+    std::cout << "\n=== Testing JSON Merge Patch ===\n";
+
+    try {
+        const Json base = Json::Parse(R"({
+            "title": "Goodbye!",
+            "author": {"givenName": "John", "familyName": "Doe"},
+            "tags": ["example", "sample"],
+            "content": "This will be unchanged",
+            "limits": [1, 2, 3]
+        })");
+        const Json overlay = Json::Parse(R"({
+            "title": "Hello!",
+            "phoneNumber": "+01-123-456-7890",
+            "author": {"familyName": null},
+            "tags": ["example"],
+            "extra": {"kept": 1, "dropped": null}
+        })");
+
+        Json merged = Json::MergePatch(base, overlay);
+        results.expect(merged == Json::Parse(R"({
+            "title": "Hello!",
+            "author": {"givenName": "John"},
+            "tags": ["example"],
+            "content": "This will be unchanged",
+            "phoneNumber": "+01-123-456-7890",
+            "limits": [1, 2, 3],
+            "extra": {"kept": 1}
+        })"), "Merge patch follows RFC 7386");
+        results.expect(base["author"].Contains("familyName") && base["title"].Get<std::string>() == "Goodbye!",
+                       "Copied arguments are left unchanged");
+        results.expect(ArrayData(merged["limits"]) == ArrayData(base["limits"]), "Untouched values stay shared");
+
+        Json tenant = base;
+        for (int layer = 0; layer < 5; ++layer) {
+            Json patch = Json::Object();
+            patch["layer"] = layer;
+            patch["content"] = layer % 2 ? Json() : Json("layered");
+            tenant = Json::MergePatch(std::move(tenant), std::move(patch));
+        }
+        results.expect(tenant["layer"].Get<int>() == 4 && tenant["content"].Get<std::string>() == "layered",
+                       "Layered patches applied in order");
+
+        Json tags = Json::Parse(R"(["a", "b"])");
+        const Json* tag_storage = ArrayData(tags);
+        Json replaced = Json::MergePatch(Json::Object(), Json::Parse(R"({"x": {"y": null}})"));
+        Json moved = Json::MergePatch(Json::Parse(R"({"tags": 1})"), [&] {
+            Json patch = Json::Object();
+            patch["tags"] = std::move(tags);
+            return patch;
+        }());
+        results.expect(ArrayData(moved["tags"]) == tag_storage, "Replacing subtrees takes the patch value by move");
+        results.expect(replaced.ToString() == R"({"x":{}})", "Nulls inside new subtrees are dropped");
+
+        results.expect(Json::MergePatch(Json::Parse(R"({"a": 1})"), Json::Parse("[1, 2]")).ToString() == "[1,2]" &&
+                       Json::MergePatch(Json(5), Json::Parse(R"({"a": null})")).ToString() == "{}",
+                       "Non-object patches replace and non-object targets become objects");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("JSON Merge Patch exception: ") + e.what());
+    }
+}
+
+void testDiff() {
+    std::cout << "\n=== Testing Structural Diff ===\n";
+
+    try {
+        const Json a = Json::Parse(R"({
+            "name": "svc", "replicas": 3, "ports": [80, 443, 8080],
+            "labels": {"tier": "web", "a/b~c": 1}, "old": true
+        })");
+        const Json b = Json::Parse(R"({
+            "name": "svc", "replicas": 5, "ports": [80, 444],
+            "labels": {"tier": "web", "a/b~c": 2, "zone": "eu"}, "new": [1]
+        })");
+
+        Json ops = Json::Diff(a, b);
+        results.expect(Json::ApplyPatch(a, ops) == b, "Diff produces a patch from a to b");
+        results.expect(ops.Size() == 7, "Diff emits only the changed values");
+        bool escaped = false;
+        for (const Json& op : ops) escaped = escaped || op["path"].Get<std::string>() == "/labels/a~1b~0c";
+        results.expect(escaped, "Diff escapes pointer tokens");
+        results.expect(Json::Diff(a, a).Size() == 0 && Json::Diff(a, Json::Parse(a.ToString())).Size() == 0,
+                       "Equal documents produce an empty patch");
+        results.expect(Json::Diff(Json(1), Json("1")) == Json::Parse(R"([{"op":"replace","path":"","value":"1"}])"),
+                       "Root replacement");
+
+        Json grown = Json::Parse("[1, 2]");
+        Json shrunk = Json::Parse("[1, 2, 3, 4]");
+        results.expect(Json::ApplyPatch(shrunk, Json::Diff(shrunk, grown)) == grown &&
+                       Json::ApplyPatch(grown, Json::Diff(grown, shrunk)) == shrunk,
+                       "Array length changes round-trip");
+
+        // A one-field change in a large COW copy: every other element is shared
+        Json state = Json::Object();
+        Json items = Json::Array();
+        for (int i = 0; i < 200000; ++i) {
+            Json item = Json::Object();
+            item["id"] = i;
+            item["price"] = i * 0.25;
+            items.PushBack(std::move(item));
+        }
+        state["items"] = std::move(items);
+        Json next = state;
+        next["items"][1234]["price"] = 1.0;
+        Json delta = Json::Diff(state, next);
+        results.expect(delta.Size() == 1 && delta[0]["path"].Get<std::string>() == "/items/1234/price" &&
+                       delta[0]["value"].Get<double>() == 1.0,
+                       "Diff of a COW copy reports the single change");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Structural diff exception: ") + e.what());
+    }
+}
+
+void testChangeTracker() {
+    std::cout << "\n=== Testing Change Tracking ===\n";
+
+    try {
+        Json state = Json::Parse(R"({"routes": [{"host": "a", "weight": 10}], "hosts": ["a"], "mode": "live"})");
+        Json follower = state;
+
+        Json::ChangeTracker tracker(state);
+        results.expect(!tracker.Changed() && tracker.Drain().Size() == 0, "Fresh tracker has no changes");
+
+        state["routes"][0]["weight"] = 20;
+        state["hosts"].PushBack("b");
+        state["hosts"].PushBack("c");
+        state["hosts"].PopBack();
+        state.Remove("mode");
+        state["routes"].Reserve(64);
+        results.expect(tracker.Changed(), "Tracker sees pending changes");
+
+        Json patch = tracker.Drain();
+        results.expect(patch.Size() == 3, "Journal holds the net changes");
+        follower = Json::ApplyPatch(follower, patch);
+        results.expect(follower == state, "Drained journal replicates the document");
+        results.expect(!tracker.Changed() && tracker.Drain().Size() == 0, "Drain resets the journal");
+
+        state["routes"][0]["host"] = "z";
+        state["routes"][0]["host"] = "a";
+        Json repeated = tracker.Drain();
+        results.expect(repeated.Size() == 1 && repeated[0]["value"] == Json("a"),
+                       "Repeated writes to one path fold into one operation");
+        follower = Json::ApplyPatch(follower, repeated);
+
+        state["extra"] = Json::Parse(R"({"nested": [1, 2]})");
+        tracker.Reset();
+        results.expect(tracker.Drain().Size() == 0, "Reset discards pending changes");
+
+        // References taken before construction or a drain must not alias the baseline
+        Json config = Json::Parse(R"({"hosts": [], "limits": {"rps": 10}})");
+        Json& hosts = config["hosts"];
+        Json& rps = config["limits"]["rps"];
+        Json::ChangeTracker held(config);
+        hosts.PushBack("a");
+        Json first = held.Drain();
+        results.expect(first.Size() == 1 && first[0]["op"].Get<std::string>() == "add",
+                       "Writes through references held before tracking are recorded");
+        rps = 20;
+        hosts.PushBack("b");
+        results.expect(held.Drain().Size() == 2 && &config["hosts"] == &hosts,
+                       "Writes through references held across a drain are recorded");
+
+        // Bulk access, reordering and moves
+        Json list = Json::Parse(R"({"items": [{"k": 3}, {"k": 1}, {"k": 2}, {"k": 1}], "tags": {"a": 1}})");
+        Json replica = list;
+        Json::ChangeTracker bulk(list);
+        for (Json& item : list["items"]) item["seen"] = true;
+        for (auto [key, value] : list["tags"].ObjectItems()) value = 2;
+        list["items"].SortBy("/k");
+        const size_t removed = list["items"].UniqueBy("/k");
+        std::swap(list["items"][0], list["items"][1]);
+        Json taken = std::move(list["tags"]);
+        results.expect(removed == 1 && list["tags"] == taken, "Moving out of a tracked value copies it");
+        replica = Json::ApplyPatch(replica, bulk.Drain());
+        results.expect(replica == list, "Iteration, SortBy, UniqueBy and swaps replay from the journal");
+
+        Json counters = Json::Array();
+        for (int i = 0; i < 5000; ++i) counters.PushBack(Json::Parse(R"({"n": 0})"));
+        Json counters_replica = counters;
+        Json::ChangeTracker parallel(counters);
+        counters.ParallelForEach([](Json& counter) { counter["n"] = 1; });
+        Json parallel_patch = parallel.Drain();
+        counters_replica = Json::ApplyPatch(counters_replica, parallel_patch);
+        results.expect(parallel_patch.Size() == 5000 && counters_replica == counters,
+                       "Writes from ParallelForEach are all recorded");
+
+        Json copy = list;
+        copy["items"][0]["k"] = 10;
+        copy["extra"] = 1;
+        results.expect(!bulk.Changed(), "Writes to a copy of a tracked document are not recorded");
+
+        // Draining costs what changed, not the size of the document
+        auto drain_allocations = [](size_t rows) {
+            Json doc = Json::Parse(R"({"routes": [{"weight": 1}]})");
+            Json big = Json::Array();
+            for (size_t i = 0; i < rows; ++i) big.PushBack(Json::Parse(R"({"id": 1, "tags": ["x"]})"));
+            doc["big"] = std::move(big);
+            Json::ChangeTracker tracker(doc);
+            const size_t before = allocations.load();
+            doc["routes"][0]["weight"] = 2;
+            Json patch = tracker.Drain();
+            return std::pair(allocations.load() - before, patch.Size());
+        };
+        auto [small_cost, small_ops] = drain_allocations(10);
+        auto [large_cost, large_ops] = drain_allocations(20000);
+        results.expect(small_ops == 1 && large_ops == 1 && large_cost <= small_cost + 8,
+                       "Single-change drain does not copy untouched containers");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Change tracking exception: ") + e.what());
+    }
+}
+
+int main() {
+    std::cout << "JSON Library Patch Test Suite\n";
+    std::cout << "=============================\n";
+
+    testJsonPatch();
+    testMergePatch();
+    testDiff();
+    testChangeTracker();
+
+    results.print_summary();
+    return results.failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,230 @@
+#include "../Json.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <sstream>
+
+// Test result tracking
+struct TestResults {
+    int passed = 0;
+    int failed = 0;
+    std::vector<std::string> failures;
+
+    void expect(bool condition, const std::string& test_name) {
+        if (condition) {
+            passed++;
+            std::cout << "✓ " << test_name << std::endl;
+        } else {
+            failed++;
+            failures.push_back(test_name);
+            std::cout << "✗ " << test_name << std::endl;
+        }
+    }
+
+    void print_summary() {
+        std::cout << "\n=== Test Summary ===" << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        if (!failures.empty()) {
+            std::cout << "Failed tests:" << std::endl;
+            for (const auto& failure : failures) {
+                std::cout << "  - " << failure << std::endl;
+            }
+        }
+    }
+};
+
+TestResults results;
+
+const char* kStore = R"({
+    "store": {
+        "book": [
+            {"category": "reference", "author": "Nigel Rees", "title": "Sayings of the Century", "price": 8.95},
+            {"category": "fiction", "author": "Evelyn Waugh", "title": "Sword of Honour", "price": 12.99},
+            {"category": "fiction", "author": "Herman Melville", "title": "Moby Dick", "isbn": "0-553-21311-3", "price": 8.99},
+            {"category": "fiction", "author": "J. R. R. Tolkien", "title": "The Lord of the Rings", "isbn": "0-395-19395-8", "price": 22.99}
+        ],
+        "bicycle": {"color": "red", "price": 19.95}
+    },
+    "expensive": 10
+})";
+
+std::vector<std::string> Strings(const std::vector<const Json*>& matches) {
+    std::vector<std::string> out;
+    for (const Json* match : matches) out.push_back(match->Get<std::string>());
+    return out;
+}
+
+void testCompiledPaths() {
+    std::cout << "\n=== Testing Compiled JSONPath ===\n";
+
+    try {
+        const Json doc = Json::Parse(kStore);
+
+        auto titles = Strings(doc.Query(Json::Path("$.store.book[*].title")));
+        results.expect(titles.size() == 4 && titles[2] == "Moby Dick", "Wildcard over array keeps order");
+
+        auto cheap = Strings(doc.Query(Json::Path("$.store.book[?(@.price < 10)].title")));
+        results.expect((cheap == std::vector<std::string>{"Sayings of the Century", "Moby Dick"}), "Filter with comparison");
+
+        results.expect(doc.Query(Json::Path("$..price")).size() == 5, "Recursive descent finds every price");
+        results.expect(doc.Query(Json::Path("$..book[?(@.isbn)]")).size() == 2, "Existence filter");
+        results.expect(doc.Query(Json::Path("$.store.book[?(@.price > $.expensive)]")).size() == 2,
+                       "Filter comparing against the root");
+        results.expect(Strings(doc.Query(Json::Path("$['store']['book'][-1]['author']"))) ==
+                       std::vector<std::string>{"J. R. R. Tolkien"}, "Bracket names and negative index");
+        results.expect(Strings(doc.Query(Json::Path("$.store.book[0,2].author"))) ==
+                       std::vector<std::string>{"Nigel Rees", "Herman Melville"}, "Index union");
+        results.expect(Strings(doc.Query(Json::Path("$.store.book[1:3].title"))) ==
+                       std::vector<std::string>{"Sword of Honour", "Moby Dick"}, "Slice");
+        results.expect(Strings(doc.Query(Json::Path("$.store.book[::-2].title"))) ==
+                       std::vector<std::string>{"The Lord of the Rings", "Sword of Honour"}, "Negative step slice");
+
+        const Json six = Json::Parse("[0, 1, 2, 3, 4, 5]");
+        auto sliced = [&six](const char* path) {
+            std::vector<int> out;
+            for (const Json* match : six.Query(Json::Path(path))) out.push_back(match->Get<int>());
+            return out;
+        };
+        results.expect(sliced("$[5:6:9223372036854775807]") == std::vector<int>{5} &&
+                       sliced("$[::9223372036854775807]") == std::vector<int>{0},
+                       "Slice with a huge positive step stays in range");
+        results.expect(sliced("$[::-9223372036854775807]") == std::vector<int>{5} &&
+                       sliced("$[4::-9223372036854775808]") == std::vector<int>{4},
+                       "Slice with a huge negative step stays in range");
+
+        auto fiction = doc.Query(Json::Path(
+            "$.store.book[?(@.category == 'fiction' && !(@.price >= 20 || @.author == \"Evelyn Waugh\"))].title"));
+        results.expect(fiction.size() == 1 && fiction[0]->Get<std::string>() == "Moby Dick", "Logical operators and grouping");
+
+        const Json& bicycle = doc["store"]["bicycle"];
+        auto color = doc.Query(Json::Path("$.store.bicycle.color"));
+        results.expect(color.size() == 1 && color[0] == &bicycle["color"], "Results reference the document");
+        results.expect(doc.Query(Json::Path("$")).front() == &doc, "Root path selects the document");
+        results.expect(doc.Query(Json::Path("$.store.missing[0]")).empty(), "Unmatched path is empty");
+
+        const Json::Path reused("$.store.*.price");
+        std::vector<const Json*> out;
+        doc.Query(reused, out);
+        doc.Query(reused, out);
+        results.expect(out.size() == 2, "Compiled path reused and results appended");
+
+        bool threw = false;
+        try {
+            Json::Path bad("$.store[?(@.price < )]");
+        } catch (const JsonException&) {
+            threw = true;
+        }
+        results.expect(threw, "Malformed path throws JsonException");
+
+        Json emoji = Json::Object();
+        emoji["\xF0\x9F\x98\x80"] = "grin";  // U+1F600 as UTF-8
+        emoji["\xC3\xA9"] = "acute";         // U+00E9
+        results.expect(Strings(emoji.Query(Json::Path(R"($['\uD83D\uDE00'])"))) == std::vector<std::string>{"grin"},
+                       "Surrogate pair escape selects a 4-byte UTF-8 name");
+        results.expect(Strings(emoji.Query(Json::Path(R"($["\u00e9"])"))) == std::vector<std::string>{"acute"},
+                       "BMP escape selects a 2-byte UTF-8 name");
+
+        size_t rejected = 0;
+        for (const char* lone : {R"($['\uD83D'])", R"($['\uD83Dx'])", R"($['\uD83D\u0041'])", R"($['\uDE00'])"}) {
+            try {
+                Json::Path bad(lone);
+            } catch (const JsonException&) {
+                ++rejected;
+            }
+        }
+        results.expect(rejected == 4, "Lone surrogate escapes throw JsonException");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Compiled JSONPath exception: ") + e.what());
+    }
+}
+
+// Collects the string results of a streaming scan
+std::vector<std::string> Scanned(std::string_view text, const char* path) {
+    std::vector<std::string> out;
+    Json::Scan(text, Json::Path(path), [&](Json&& value) { out.push_back(value.Get<std::string>()); });
+    return out;
+}
+
+void testStreamingScan() {
+    std::cout << "\n=== Testing Streaming Scan ===\n";
+
+    try {
+        results.expect(Scanned(kStore, "$.store.book[*].author") ==
+                       std::vector<std::string>{"Nigel Rees", "Evelyn Waugh", "Herman Melville", "J. R. R. Tolkien"},
+                       "Scan emits child matches in document order");
+        results.expect(Scanned(kStore, "$..isbn") == std::vector<std::string>{"0-553-21311-3", "0-395-19395-8"},
+                       "Scan recursive descent");
+        results.expect(Scanned(kStore, "$.store.book[1:4:2].title") ==
+                       std::vector<std::string>{"Sword of Honour", "The Lord of the Rings"},
+                       "Scan slice decided from indices");
+        results.expect(Scanned(kStore, "$.store.book[?(@.price < 10)].title") ==
+                       std::vector<std::string>{"Sayings of the Century", "Moby Dick"},
+                       "Scan filter evaluated on the candidate array");
+        results.expect(Scanned(kStore, "$.store.book[-1].author") == std::vector<std::string>{"J. R. R. Tolkien"},
+                       "Scan negative index");
+        results.expect(Scanned(kStore, "$.store.book[?(@.price > $.expensive)].title") ==
+                       std::vector<std::string>{"Sword of Honour", "The Lord of the Rings"},
+                       "Scan filter referring to the root");
+
+        Json bicycle;
+        size_t count = Json::Scan(kStore, Json::Path("$.store.bicycle"), [&](Json&& value) { bicycle = std::move(value); });
+        results.expect(count == 1 && bicycle == Json::Parse(kStore)["store"]["bicycle"], "Scan materializes whole subtrees");
+
+        // Unmatched subtrees are skipped without being built, but still checked
+        results.expect(Scanned(R"({"skip": [true, -0.5e+3, {"x": "\"]\u00e9"}], "k\u0065y": "found"})", "$.key") ==
+                           std::vector<std::string>{"found"},
+                       "Scan skips unmatched subtrees and decodes escaped keys");
+        size_t malformed = 0;
+        for (const char* text : {R"({"x":tru,"a":1})", R"({"x":[1,2},"a":1})", R"({"x":01,"a":1})",
+                                 R"({"x":"\q","a":1})", R"({"x":{"y"},"a":1})", R"({"x":[1,],"a":1})"}) {
+            try {
+                Json::Scan(text, Json::Path("$.a"), [](Json&&) {});
+            } catch (const JsonParseError&) {
+                ++malformed;
+            }
+        }
+        results.expect(malformed == 6, "Scan rejects malformed values in skipped subtrees");
+
+        results.expect(Scanned(R"({"a": [{"b": "x"}, {"b": "y"}]})", "$.a[0,0].b") == std::vector<std::string>{"x", "x"},
+                       "Scan emits a union's repeated selections like Query");
+
+        const std::string ndjson = "{\"level\":\"info\",\"msg\":\"start\"}\n"
+                                   "\n"
+                                   "{\"level\":\"error\",\"msg\":\"disk full\"}\r\n"
+                                   "{\"level\":\"error\",\"msg\":\"retry\"}\n";
+        std::vector<size_t> lines;
+        Json::ScanLines(ndjson, Json::Path("$.msg"), [&](size_t line, Json&&) { lines.push_back(line); });
+        results.expect(lines == std::vector<size_t>{1, 3, 4}, "ScanLines reports line numbers and skips blank lines");
+
+        std::istringstream stream(ndjson);
+        std::vector<std::string> messages;
+        Json::ScanLines(stream, Json::Path("$.msg"), [&](size_t line, Json&& value) {
+            if (line > 1) messages.push_back(value.Get<std::string>());
+        });
+        results.expect(messages == std::vector<std::string>{"disk full", "retry"}, "ScanLines reads from a stream");
+
+        size_t line = 0, column = 0;
+        try {
+            Json::ScanLines("{\"a\": 1}\n{\"a\" 2}\n", Json::Path("$.a"), [](size_t, Json&&) {});
+        } catch (const JsonParseError& e) {
+            line = e.Line();
+            column = e.Column();
+        }
+        results.expect(line == 2 && column == 6, "Scan reports the position of malformed input");
+    } catch (const std::exception& e) {
+        results.expect(false, std::string("Streaming scan exception: ") + e.what());
+    }
+}
+
+int main() {
+    std::cout << "JSON Library Query Test Suite\n";
+    std::cout << "=============================\n";
+
+    testCompiledPaths();
+    testStreamingScan();
+
+    results.print_summary();
+    return results.failed == 0 ? 0 : 1;
+}